@@ -29,6 +29,7 @@ void density_benchmark_version() {
     DENSITY_BENCHMARK_BOLD(printf("Centaurean Density %i.%i.%i\n", density_version_major(), density_version_minor(), density_version_revision()));
     printf("Copyright (C) 2015 Guillaume Voirin\n");
     printf("Built for %s (%s endian system, %u bits) using " DENSITY_BENCHMARK_COMPILER ", %s %s\n", DENSITY_BENCHMARK_PLATFORM_STRING, DENSITY_BENCHMARK_ENDIAN_STRING, (unsigned int) (8 * sizeof(void *)), DENSITY_BENCHMARK_COMPILER_VERSION, __DATE__, __TIME__);
+    printf("Kernels running with %s instruction set\n", density_get_instruction_set());
 }
 
 void density_benchmark_client_usage() {
@@ -46,7 +47,8 @@ void density_benchmark_client_usage() {
     printf("                                    3 = Lion algorithm\n");
     printf("  -c                                Compress only\n");
     printf("  -f                                Activate fuzzer mode (pseudorandom generated data)\n");
-    printf("  -h                                Print data hashing informations\n\n");
+    printf("  -h                                Print data hashing informations\n");
+    printf("  -p                                Compare speeds with dictionaries on regular and huge pages\n\n");
     exit(EXIT_SUCCESS);
 }
 
@@ -76,6 +78,62 @@ const char *density_benchmark_convert_state_to_text(DENSITY_STATE state) {
     }
 }
 
+double density_benchmark_context_time(const uint8_t *input, const uint_fast64_t input_size, uint8_t *output, const uint_fast64_t output_size, density_context *const context, const bool compress) {
+    double time_low = 60.0;
+    double total_time = 0.0;
+    cputime_chronometer chrono;
+
+    while (total_time <= 2.0) {
+        cputime_chronometer_start(&chrono);
+        density_reset_context(context);
+        if (compress)
+            density_compress_with_context(input, input_size, output, output_size, context);
+        else
+            density_decompress_with_context(input, input_size, output, output_size, context);
+        const double time_elapsed = cputime_chronometer_stop(&chrono);
+
+        if (time_elapsed < time_low)
+            time_low = time_elapsed;
+        total_time += time_elapsed;
+    }
+    return time_low;
+}
+
+void density_benchmark_print_pages_speeds(const char *operation, const uint_fast64_t size, const double regular_time, const double huge_time) {
+    const double regular_speed = (1.0 * size) / (regular_time * 1000.0 * 1000.0);
+    const double huge_speed = (1.0 * size) / (huge_time * 1000.0 * 1000.0);
+    printf("%s speed with dictionary on regular pages ", operation);
+    DENSITY_BENCHMARK_BOLD(printf("%.0lf MB/s", regular_speed));
+    printf(", on huge pages ");
+    DENSITY_BENCHMARK_BOLD(printf("%.0lf MB/s", huge_speed));
+    printf(" (%+.1lf%%)\n", 100.0 * (huge_speed - regular_speed) / regular_speed);
+}
+
+void density_benchmark_pages(const DENSITY_ALGORITHM algorithm, uint8_t *in, const uint_fast64_t uncompressed_size, uint8_t *out, const uint_fast64_t compressed_size, const uint_fast64_t memory_allocated, const bool compression_only) {
+    density_context *regular_context = density_compress_prepare_context(algorithm, false, NULL).context;
+    density_context *huge_context = density_compress_prepare_context(algorithm, false, NULL).context;
+    if (density_enable_huge_pages(huge_context, NULL)) {
+        DENSITY_BENCHMARK_ERROR(printf("Unable to allocate a dictionary on huge pages."), true);
+    }
+    const double compress_regular_time = density_benchmark_context_time(in, uncompressed_size, out, memory_allocated, regular_context, true);
+    const double compress_huge_time = density_benchmark_context_time(in, uncompressed_size, out, memory_allocated, huge_context, true);
+    density_benchmark_print_pages_speeds("Compress", uncompressed_size, compress_regular_time, compress_huge_time);
+    density_free_context(regular_context, NULL);
+    density_free_context(huge_context, NULL);
+    if (compression_only)
+        return;
+
+    density_processing_result result = density_decompress_prepare_context(out, compressed_size, false, NULL);
+    regular_context = result.context;
+    huge_context = density_decompress_prepare_context(out, compressed_size, false, NULL).context;
+    density_enable_huge_pages(huge_context, NULL);
+    const double decompress_regular_time = density_benchmark_context_time(out + result.bytesRead, compressed_size - result.bytesRead, in, memory_allocated, regular_context, false);
+    const double decompress_huge_time = density_benchmark_context_time(out + result.bytesRead, compressed_size - result.bytesRead, in, memory_allocated, huge_context, false);
+    density_benchmark_print_pages_speeds("Decompress", uncompressed_size, decompress_regular_time, decompress_huge_time);
+    density_free_context(regular_context, NULL);
+    density_free_context(huge_context, NULL);
+}
+
 int main(int argc, char *argv[]) {
     density_benchmark_version();
     DENSITY_ALGORITHM start_mode = DENSITY_ALGORITHM_CHAMELEON;
@@ -83,6 +141,7 @@ int main(int argc, char *argv[]) {
     bool compression_only = false;
     bool fuzzer = false;
     bool hash_info = false;
+    bool huge_pages = false;
     char *file_path = NULL;
 
     if (argc <= 1)
@@ -111,6 +170,9 @@ int main(int argc, char *argv[]) {
                 case 'h':
                     hash_info = true;
                     break;
+                case 'p':
+                    huge_pages = true;
+                    break;
                 default:
                     density_benchmark_client_usage();
             }
@@ -333,7 +395,10 @@ int main(int argc, char *argv[]) {
             }
             fflush(stdout);
         }
-        printf("\nRun time %.3lfs (%i iterations)\n\n", total_time, iterations);
+        printf("\nRun time %.3lfs (%i iterations)\n", total_time, iterations);
+        if (huge_pages)
+            density_benchmark_pages(compression_mode, in, uncompressed_size, out, compressed_size, memory_allocated, compression_only);
+        printf("\n");
     }
 
     free(in);
@@ -33,11 +33,163 @@
  */
 
 #include "algorithms.h"
+#include "chameleon/core/chameleon_encode.h"
+#include "chameleon/core/chameleon_decode.h"
+#include "cheetah/core/cheetah_encode.h"
+#include "cheetah/core/cheetah_decode.h"
+#include "lion/core/lion_encode.h"
+#include "lion/core/lion_decode.h"
 
-DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE void density_algorithms_prepare_state(density_algorithm_state *const DENSITY_RESTRICT state, void *const DENSITY_RESTRICT dictionary) {
+density_algorithm_kernels density_algorithms_kernels = {
+        {density_chameleon_encode, density_cheetah_encode, density_lion_encode},
+        {density_chameleon_decode, density_cheetah_decode, density_lion_decode},
+#ifdef DENSITY_DISPATCH
+        "generic"
+#else
+        "build target"
+#endif
+};
+
+#ifdef DENSITY_DISPATCH
+#define DENSITY_ALGORITHMS_SELECT_KERNELS(instruction_set, name)\
+    density_algorithms_kernels = (density_algorithm_kernels) {\
+        {density_chameleon_encode_##instruction_set, density_cheetah_encode_##instruction_set, density_lion_encode_##instruction_set},\
+        {density_chameleon_decode_##instruction_set, density_cheetah_decode_##instruction_set, density_lion_decode_##instruction_set},\
+        name\
+    }
+
+__attribute__((constructor)) void density_algorithms_select_kernels(void) {
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw") && __builtin_cpu_supports("avx512vl") && __builtin_cpu_supports("avx512dq") && __builtin_cpu_supports("bmi2"))
+        DENSITY_ALGORITHMS_SELECT_KERNELS(avx512, "AVX-512");
+    else if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("bmi2") && __builtin_cpu_supports("fma"))
+        DENSITY_ALGORITHMS_SELECT_KERNELS(avx2, "AVX2");
+    else if (__builtin_cpu_supports("sse4.2") && __builtin_cpu_supports("popcnt"))
+        DENSITY_ALGORITHMS_SELECT_KERNELS(sse4_2, "SSE4.2");
+}
+#endif
+
+DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE void density_algorithms_prepare_state(density_algorithm_state *const DENSITY_RESTRICT state, void *const DENSITY_RESTRICT dictionary, const uint_fast8_t hash_bits) {
     state->dictionary = dictionary;
+    state->hash_bits = hash_bits;
+    state->epochs = NULL;
+    state->static_dictionary = false;
+    density_algorithms_reset_copy_penalty(state);
+    state->last_hash = 0;
+    state->model = NULL;
+    state->decompressed_size = 0;
+}
+
+DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE void density_algorithms_reset_copy_penalty(density_algorithm_state *const state) {
     state->copy_penalty = 0;
     state->copy_penalty_start = 1;
     state->previous_incompressible = false;
     state->counter = 0;
 }
+
+DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE void density_algorithms_epochs_init(density_algorithm_epochs *const epochs) {
+    DENSITY_MEMSET(epochs->pages, 0, sizeof(epochs->pages));
+    epochs->current = 1;    // Every page is stale, base is left as is
+    epochs->stale = true;
+}
+
+DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE void density_algorithms_epochs_advance(density_algorithm_epochs *const epochs) {
+    if (DENSITY_UNLIKELY(!++epochs->current))
+        density_algorithms_epochs_init(epochs);     // Tags wrapped around, old tags could otherwise be mistaken for current ones
+    epochs->stale = true;
+}
+
+DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE void density_algorithms_epochs_refresh(density_algorithm_epochs *const epochs, const uint_fast8_t hash_bits) {
+    // The dictionary memory was brought up to date as a whole, every page it spans is current
+    for (uint_fast32_t page = 0; page < ((uint_fast32_t) 1 << (hash_bits - DENSITY_ALGORITHMS_EPOCHS_PAGE_BITS)); page++)
+        epochs->pages[page] = epochs->current;
+    epochs->stale = false;
+}
+
+DENSITY_WINDOWS_EXPORT void density_algorithms_epochs_flush(const DENSITY_ALGORITHM algorithm, void *const DENSITY_RESTRICT dictionary, density_algorithm_epochs *const DENSITY_RESTRICT epochs, const uint_fast8_t hash_bits) {
+    // Bring every stale page up to date, so that the dictionary memory holds what the kernels would see
+    for (uint_fast32_t hash = 0; hash < ((uint_fast32_t) 1 << hash_bits); hash += 1 << DENSITY_ALGORITHMS_EPOCHS_PAGE_BITS) {
+        switch (algorithm) {
+            case DENSITY_ALGORITHM_CHAMELEON:
+                density_chameleon_dictionary_touch((density_chameleon_dictionary *) dictionary, epochs, (uint_fast16_t) hash);
+                break;
+            case DENSITY_ALGORITHM_CHEETAH:
+                density_cheetah_dictionary_touch((density_cheetah_dictionary *) dictionary, epochs, (uint_fast16_t) hash, hash_bits);
+                break;
+            case DENSITY_ALGORITHM_LION:
+                density_lion_dictionary_touch((density_lion_dictionary *) dictionary, epochs, (uint_fast16_t) hash);
+                break;
+        }
+    }
+    epochs->stale = false;
+}
+
+DENSITY_WINDOWS_EXPORT const char *density_get_instruction_set(void) {
+    return density_algorithms_kernels.instruction_set;
+}
+
+DENSITY_WINDOWS_EXPORT density_algorithm_exit_status density_algorithms_encode(density_algorithm_state *const DENSITY_RESTRICT state, const DENSITY_ALGORITHM algorithm, const uint8_t **DENSITY_RESTRICT in, const uint_fast64_t in_size, uint8_t **DENSITY_RESTRICT out, const uint_fast64_t out_size) {
+    switch (algorithm) {
+#ifdef DENSITY_DISPATCH
+        case DENSITY_ALGORITHM_CHAMELEON:
+        case DENSITY_ALGORITHM_CHEETAH:
+        case DENSITY_ALGORITHM_LION:
+            return density_algorithms_kernels.encode[algorithm - DENSITY_ALGORITHM_CHAMELEON](state, in, in_size, out, out_size);
+#else
+        case DENSITY_ALGORITHM_CHAMELEON:
+            return density_chameleon_encode(state, in, in_size, out, out_size);
+        case DENSITY_ALGORITHM_CHEETAH:
+            return density_cheetah_encode(state, in, in_size, out, out_size);
+        case DENSITY_ALGORITHM_LION:
+            return density_lion_encode(state, in, in_size, out, out_size);
+#endif
+        default:
+            return DENSITY_ALGORITHMS_EXIT_STATUS_ERROR_DURING_PROCESSING;
+    }
+}
+
+/*
+ * Lockstep encoding pays off for Chameleon's scalar kernel only : its vectorized kernel already keeps several dictionary loads in flight,
+ * and Cheetah's branches mispredict more often once two streams are interleaved
+ */
+DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE bool density_algorithms_encode_pair_available(const DENSITY_ALGORITHM algorithm) {
+    if (algorithm != DENSITY_ALGORITHM_CHAMELEON)
+        return false;
+#ifdef DENSITY_DISPATCH
+    return density_algorithms_kernels.encode[0] == density_chameleon_encode || density_algorithms_kernels.encode[0] == density_chameleon_encode_sse4_2;
+#elif defined(__AVX2__)
+    return false;
+#else
+    return true;
+#endif
+}
+
+DENSITY_WINDOWS_EXPORT density_algorithm_exit_status density_algorithms_encode_pair(density_algorithm_state *const *DENSITY_RESTRICT states, const DENSITY_ALGORITHM algorithm, const uint8_t **DENSITY_RESTRICT in, const uint_fast64_t *DENSITY_RESTRICT in_size, uint8_t **DENSITY_RESTRICT out, const uint_fast64_t *DENSITY_RESTRICT out_size) {
+    if (density_algorithms_encode_pair_available(algorithm) && states[0]->hash_bits == states[1]->hash_bits && !DENSITY_ALGORITHMS_EPOCHS(states[0]) == !DENSITY_ALGORITHMS_EPOCHS(states[1]))
+        return density_chameleon_encode_pair(states, in, in_size, out, out_size);
+
+    const density_algorithm_exit_status status = density_algorithms_encode(states[0], algorithm, &in[0], in_size[0], &out[0], out_size[0]);
+    if (status)
+        return status;
+    return density_algorithms_encode(states[1], algorithm, &in[1], in_size[1], &out[1], out_size[1]);
+}
+
+DENSITY_WINDOWS_EXPORT density_algorithm_exit_status density_algorithms_decode(density_algorithm_state *const DENSITY_RESTRICT state, const DENSITY_ALGORITHM algorithm, const uint8_t **DENSITY_RESTRICT in, const uint_fast64_t in_size, uint8_t **DENSITY_RESTRICT out, const uint_fast64_t out_size) {
+    switch (algorithm) {
+#ifdef DENSITY_DISPATCH
+        case DENSITY_ALGORITHM_CHAMELEON:
+        case DENSITY_ALGORITHM_CHEETAH:
+        case DENSITY_ALGORITHM_LION:
+            return density_algorithms_kernels.decode[algorithm - DENSITY_ALGORITHM_CHAMELEON](state, in, in_size, out, out_size);
+#else
+        case DENSITY_ALGORITHM_CHAMELEON:
+            return density_chameleon_decode(state, in, in_size, out, out_size);
+        case DENSITY_ALGORITHM_CHEETAH:
+            return density_cheetah_decode(state, in, in_size, out, out_size);
+        case DENSITY_ALGORITHM_LION:
+            return density_lion_decode(state, in, in_size, out, out_size);
+#endif
+        default:
+            return DENSITY_ALGORITHMS_EXIT_STATUS_ERROR_DURING_PROCESSING;
+    }
+}
@@ -44,12 +44,33 @@ typedef enum {
     DENSITY_ALGORITHMS_EXIT_STATUS_OUTPUT_STALL
 } density_algorithm_exit_status;
 
+#define DENSITY_ALGORITHMS_EPOCHS_PAGE_BITS         2
+#define DENSITY_ALGORITHMS_EPOCHS_PAGES             (1 << (DENSITY_HASH_BITS_MAXIMUM - DENSITY_ALGORITHMS_EPOCHS_PAGE_BITS))
+
+/*
+ * Lazy dictionary reset : the hash space is split in pages of (1 << DENSITY_ALGORITHMS_EPOCHS_PAGE_BITS) hashes,
+ * and a page whose tag differs from the current epoch is stale and gets zeroed on first access.
+ * When base is set, stale pages are copied from it instead, base having the layout of the dictionary.
+ */
+typedef struct {
+    uint16_t current;
+    uint16_t pages[DENSITY_ALGORITHMS_EPOCHS_PAGES];
+    const uint8_t *base;
+    bool stale;     // Some pages may be stale, kernels only need to check tags while it is set
+} density_algorithm_epochs;
+
 typedef struct {
     void *dictionary;
+    uint_fast8_t hash_bits;
+    density_algorithm_epochs *epochs;
+    bool static_dictionary;     // Dictionary is only looked up, never updated, and can therefore be shared between states
     uint_fast8_t copy_penalty;
     uint_fast8_t copy_penalty_start;
     bool previous_incompressible;
     uint_fast64_t counter;
+    uint_fast16_t last_hash;    // Predictions context left by the previous call, kernels store it back once finished
+    void *model;                // Lion form model carried between calls when not NULL, a fresh one is used otherwise
+    uint_fast64_t decompressed_size;    // Exact decompressed size when known beforehand, 0 otherwise
 } density_algorithm_state;
 
 #define DENSITY_ALGORITHM_COPY(work_block_size)\
@@ -73,6 +94,64 @@ typedef struct {
             } else\
                 state->previous_incompressible = false;
 
-DENSITY_WINDOWS_EXPORT void density_algorithms_prepare_state(density_algorithm_state *const DENSITY_RESTRICT_DECLARE, void *const DENSITY_RESTRICT_DECLARE);
+/*
+ * Kernels get a dedicated instance for their common case : default hash width, no lazy reset and a dictionary updated as data goes,
+ * so that hashing and masking use constant shifts there. Every other case shares one instance taking these parameters at run time,
+ * which keeps build time and code size close to those of a single kernel.
+ * Lion does not use it : its kernels are large enough for the extra instance to cost more than it brings.
+ */
+#define DENSITY_ALGORITHMS_EPOCHS(state)                ((state)->static_dictionary || (state)->epochs == NULL || !(state)->epochs->stale ? NULL : (state)->epochs)
+#define DENSITY_ALGORITHMS_DEFAULT_CASE(state)          (!(state)->static_dictionary && !DENSITY_ALGORITHMS_EPOCHS(state) && (state)->hash_bits == DENSITY_HASH_BITS_DEFAULT)
+#define DENSITY_ALGORITHMS_VALID_HASH_BITS(hash_bits)   ((hash_bits) >= DENSITY_HASH_BITS_MINIMUM && (hash_bits) <= DENSITY_HASH_BITS_MAXIMUM)
+
+typedef density_algorithm_exit_status (*density_algorithm_kernel)(density_algorithm_state *const DENSITY_RESTRICT_DECLARE, const uint8_t **DENSITY_RESTRICT_DECLARE, const uint_fast64_t, uint8_t **DENSITY_RESTRICT_DECLARE, const uint_fast64_t);
+
+#ifdef DENSITY_DISPATCH
+#define DENSITY_ALGORITHMS_KERNEL_VARIANT(kernel, instruction_set, target, body)\
+    DENSITY_WINDOWS_EXPORT target density_algorithm_exit_status kernel##_##instruction_set(density_algorithm_state *const DENSITY_RESTRICT state, const uint8_t **DENSITY_RESTRICT in, const uint_fast64_t in_size, uint8_t **DENSITY_RESTRICT out, const uint_fast64_t out_size) {\
+        return body(state, in, in_size, out, out_size);\
+    }
+
+#define DENSITY_ALGORITHMS_KERNEL_VARIANTS(kernel)\
+    DENSITY_ALGORITHMS_KERNEL_VARIANT(kernel, sse4_2, DENSITY_TARGET_SSE4_2, kernel)\
+    DENSITY_ALGORITHMS_KERNEL_VARIANT(kernel, avx2, DENSITY_TARGET_AVX2, kernel)\
+    DENSITY_ALGORITHMS_KERNEL_VARIANT(kernel, avx512, DENSITY_TARGET_AVX512, kernel)
+
+#define DENSITY_ALGORITHMS_KERNEL_VARIANTS_PROTOTYPES(kernel)\
+    DENSITY_WINDOWS_EXPORT density_algorithm_exit_status kernel##_sse4_2(density_algorithm_state *const DENSITY_RESTRICT_DECLARE, const uint8_t **DENSITY_RESTRICT_DECLARE, const uint_fast64_t, uint8_t **DENSITY_RESTRICT_DECLARE, const uint_fast64_t);\
+    DENSITY_WINDOWS_EXPORT density_algorithm_exit_status kernel##_avx2(density_algorithm_state *const DENSITY_RESTRICT_DECLARE, const uint8_t **DENSITY_RESTRICT_DECLARE, const uint_fast64_t, uint8_t **DENSITY_RESTRICT_DECLARE, const uint_fast64_t);\
+    DENSITY_WINDOWS_EXPORT density_algorithm_exit_status kernel##_avx512(density_algorithm_state *const DENSITY_RESTRICT_DECLARE, const uint8_t **DENSITY_RESTRICT_DECLARE, const uint_fast64_t, uint8_t **DENSITY_RESTRICT_DECLARE, const uint_fast64_t);
+#else
+#define DENSITY_ALGORITHMS_KERNEL_VARIANTS(kernel)
+#define DENSITY_ALGORITHMS_KERNEL_VARIANTS_PROTOTYPES(kernel)
+#endif
+
+typedef struct {
+    density_algorithm_kernel encode[DENSITY_ALGORITHM_LION];
+    density_algorithm_kernel decode[DENSITY_ALGORITHM_LION];
+    const char *instruction_set;
+} density_algorithm_kernels;
+
+DENSITY_WINDOWS_EXPORT void density_algorithms_prepare_state(density_algorithm_state *const DENSITY_RESTRICT_DECLARE, void *const DENSITY_RESTRICT_DECLARE, const uint_fast8_t);
+
+DENSITY_WINDOWS_EXPORT void density_algorithms_reset_copy_penalty(density_algorithm_state *const);
+
+DENSITY_WINDOWS_EXPORT void density_algorithms_epochs_init(density_algorithm_epochs *const);
+
+DENSITY_WINDOWS_EXPORT void density_algorithms_epochs_advance(density_algorithm_epochs *const);
+
+DENSITY_WINDOWS_EXPORT void density_algorithms_epochs_refresh(density_algorithm_epochs *const, const uint_fast8_t);
+
+DENSITY_WINDOWS_EXPORT void density_algorithms_epochs_flush(const DENSITY_ALGORITHM, void *const DENSITY_RESTRICT_DECLARE, density_algorithm_epochs *const DENSITY_RESTRICT_DECLARE, const uint_fast8_t);
+
+DENSITY_WINDOWS_EXPORT const char *density_get_instruction_set(void);
+
+DENSITY_WINDOWS_EXPORT density_algorithm_exit_status density_algorithms_encode(density_algorithm_state *const DENSITY_RESTRICT_DECLARE, const DENSITY_ALGORITHM, const uint8_t **DENSITY_RESTRICT_DECLARE, const uint_fast64_t, uint8_t **DENSITY_RESTRICT_DECLARE, const uint_fast64_t);
+
+DENSITY_WINDOWS_EXPORT bool density_algorithms_encode_pair_available(const DENSITY_ALGORITHM);
+
+DENSITY_WINDOWS_EXPORT density_algorithm_exit_status density_algorithms_encode_pair(density_algorithm_state *const *DENSITY_RESTRICT_DECLARE, const DENSITY_ALGORITHM, const uint8_t **DENSITY_RESTRICT_DECLARE, const uint_fast64_t *DENSITY_RESTRICT_DECLARE, uint8_t **DENSITY_RESTRICT_DECLARE, const uint_fast64_t *DENSITY_RESTRICT_DECLARE);
+
+DENSITY_WINDOWS_EXPORT density_algorithm_exit_status density_algorithms_decode(density_algorithm_state *const DENSITY_RESTRICT_DECLARE, const DENSITY_ALGORITHM, const uint8_t **DENSITY_RESTRICT_DECLARE, const uint_fast64_t, uint8_t **DENSITY_RESTRICT_DECLARE, const uint_fast64_t);
 
 #endif
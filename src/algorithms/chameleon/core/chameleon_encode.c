@@ -44,13 +44,41 @@
 
 #include "chameleon_encode.h"
 
+#ifdef DENSITY_AVX2
+/*
+ * Byte shuffles packing four units, each one being either a 2 bytes hash (signature bit set) or a 4 bytes chunk
+ */
+const uint8_t density_chameleon_encode_pack_shuffles[16][16] = {
+        {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f},
+        {0x00, 0x01, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x80, 0x80},
+        {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x80, 0x80},
+        {0x00, 0x01, 0x04, 0x05, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x80, 0x80, 0x80, 0x80},
+        {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0c, 0x0d, 0x0e, 0x0f, 0x80, 0x80},
+        {0x00, 0x01, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0c, 0x0d, 0x0e, 0x0f, 0x80, 0x80, 0x80, 0x80},
+        {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x08, 0x09, 0x0c, 0x0d, 0x0e, 0x0f, 0x80, 0x80, 0x80, 0x80},
+        {0x00, 0x01, 0x04, 0x05, 0x08, 0x09, 0x0c, 0x0d, 0x0e, 0x0f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+        {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x80, 0x80},
+        {0x00, 0x01, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x80, 0x80, 0x80, 0x80},
+        {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x80, 0x80, 0x80, 0x80},
+        {0x00, 0x01, 0x04, 0x05, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+        {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0c, 0x0d, 0x80, 0x80, 0x80, 0x80},
+        {0x00, 0x01, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0c, 0x0d, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+        {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x08, 0x09, 0x0c, 0x0d, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80},
+        {0x00, 0x01, 0x04, 0x05, 0x08, 0x09, 0x0c, 0x0d, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}
+};
+
+const uint8_t density_chameleon_encode_pack_sizes[16] = {16, 14, 14, 12, 14, 12, 12, 10, 14, 12, 12, 10, 12, 10, 10, 8};
+#endif
+
 DENSITY_FORCE_INLINE void density_chameleon_encode_prepare_signature(uint8_t **DENSITY_RESTRICT out, density_chameleon_signature **DENSITY_RESTRICT signature_pointer, density_chameleon_signature *const DENSITY_RESTRICT signature) {
     *signature = 0;
     *signature_pointer = (density_chameleon_signature *) *out;
     *out += sizeof(density_chameleon_signature);
 }
 
-DENSITY_FORCE_INLINE void density_chameleon_encode_kernel(uint8_t **DENSITY_RESTRICT out, const uint16_t hash, const uint_fast8_t shift, density_chameleon_signature *const DENSITY_RESTRICT signature, density_chameleon_dictionary *const DENSITY_RESTRICT dictionary, uint32_t *DENSITY_RESTRICT unit) {
+DENSITY_FORCE_INLINE void density_chameleon_encode_kernel(uint8_t **DENSITY_RESTRICT out, const uint16_t hash, const uint_fast8_t shift, density_chameleon_signature *const DENSITY_RESTRICT signature, density_chameleon_dictionary *const DENSITY_RESTRICT dictionary, density_algorithm_epochs *const DENSITY_RESTRICT epochs, const bool update, uint32_t *DENSITY_RESTRICT unit) {
+    if (epochs)
+        density_chameleon_dictionary_touch(dictionary, epochs, hash);
     density_chameleon_dictionary_entry *const found = &dictionary->entries[hash];
 
     switch (*unit ^ found->as_uint32_t) {
@@ -67,34 +95,143 @@ DENSITY_FORCE_INLINE void density_chameleon_encode_kernel(uint8_t **DENSITY_REST
             *out += sizeof(uint16_t);
             break;
         default:
-            found->as_uint32_t = *unit; // Does not ensure dictionary content consistency between endiannesses
+            if (update)
+                found->as_uint32_t = *unit; // Does not ensure dictionary content consistency between endiannesses
             DENSITY_MEMCPY(*out, unit, sizeof(uint32_t));
             *out += sizeof(uint32_t);
             break;
     }
 }
 
-DENSITY_FORCE_INLINE void density_chameleon_encode_4(const uint8_t **DENSITY_RESTRICT in, uint8_t **DENSITY_RESTRICT out, const uint_fast8_t shift, density_chameleon_signature *const DENSITY_RESTRICT signature, density_chameleon_dictionary *const DENSITY_RESTRICT dictionary, uint32_t *DENSITY_RESTRICT unit) {
+DENSITY_FORCE_INLINE void density_chameleon_encode_4(const uint8_t **DENSITY_RESTRICT in, uint8_t **DENSITY_RESTRICT out, const uint_fast8_t shift, density_chameleon_signature *const DENSITY_RESTRICT signature, density_chameleon_dictionary *const DENSITY_RESTRICT dictionary, density_algorithm_epochs *const DENSITY_RESTRICT epochs, const bool update, uint32_t *DENSITY_RESTRICT unit, const uint_fast8_t hash_bits) {
     DENSITY_MEMCPY(unit, *in, sizeof(uint32_t));
-    density_chameleon_encode_kernel(out, DENSITY_CHAMELEON_HASH_ALGORITHM(DENSITY_LITTLE_ENDIAN_32(*unit)), shift, signature, dictionary, unit);
+    density_chameleon_encode_kernel(out, DENSITY_CHAMELEON_HASH_ALGORITHM(DENSITY_LITTLE_ENDIAN_32(*unit), hash_bits), shift, signature, dictionary, epochs, update, unit);
     *in += sizeof(uint32_t);
 }
 
-DENSITY_FORCE_INLINE void density_chameleon_encode_256(const uint8_t **DENSITY_RESTRICT in, uint8_t **DENSITY_RESTRICT out, density_chameleon_signature *const DENSITY_RESTRICT signature, density_chameleon_dictionary *const DENSITY_RESTRICT dictionary, uint32_t *DENSITY_RESTRICT unit) {
+DENSITY_FORCE_INLINE void density_chameleon_encode_256(const uint8_t **DENSITY_RESTRICT in, uint8_t **DENSITY_RESTRICT out, density_chameleon_signature *const DENSITY_RESTRICT signature, density_chameleon_dictionary *const DENSITY_RESTRICT dictionary, density_algorithm_epochs *const DENSITY_RESTRICT epochs, const bool update, uint32_t *DENSITY_RESTRICT unit, const uint_fast8_t hash_bits) {
     uint_fast8_t count = 0;
 
 #ifdef __clang__
     for (uint_fast8_t count_b = 0; count_b < 32; count_b++) {
-        DENSITY_UNROLL_2(density_chameleon_encode_4(in, out, count++, signature, dictionary, unit));
+        DENSITY_UNROLL_2(density_chameleon_encode_4(in, out, count++, signature, dictionary, epochs, update, unit, hash_bits));
     }
 #else
     for (uint_fast8_t count_b = 0; count_b < 16; count_b++) {
-        DENSITY_UNROLL_4(density_chameleon_encode_4(in, out, count++, signature, dictionary, unit));
+        DENSITY_UNROLL_4(density_chameleon_encode_4(in, out, count++, signature, dictionary, epochs, update, unit, hash_bits));
     }
 #endif
 }
 
-DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE density_algorithm_exit_status density_chameleon_encode(density_algorithm_state *const DENSITY_RESTRICT state, const uint8_t **DENSITY_RESTRICT in, const uint_fast64_t in_size, uint8_t **DENSITY_RESTRICT out, const uint_fast64_t out_size) {
+DENSITY_FORCE_INLINE void density_chameleon_encode_256_pair(const uint8_t **DENSITY_RESTRICT in_a, uint8_t **DENSITY_RESTRICT out_a, density_chameleon_signature *const DENSITY_RESTRICT signature_a, density_chameleon_dictionary *const DENSITY_RESTRICT dictionary_a, density_algorithm_epochs *const DENSITY_RESTRICT epochs_a, const uint8_t **DENSITY_RESTRICT in_b, uint8_t **DENSITY_RESTRICT out_b, density_chameleon_signature *const DENSITY_RESTRICT signature_b, density_chameleon_dictionary *const DENSITY_RESTRICT dictionary_b, density_algorithm_epochs *const DENSITY_RESTRICT epochs_b, const uint_fast8_t hash_bits) {
+    uint_fast8_t count = 0;
+    uint32_t unit_a;
+    uint32_t unit_b;
+
+    // Units alternate between both streams, so that a dictionary miss in one does not hold the other back
+    for (uint_fast8_t count_b = 0; count_b < 16; count_b++) {
+        DENSITY_UNROLL_4(\
+        density_chameleon_encode_4(in_a, out_a, count, signature_a, dictionary_a, epochs_a, true, &unit_a, hash_bits);\
+        density_chameleon_encode_4(in_b, out_b, count, signature_b, dictionary_b, epochs_b, true, &unit_b, hash_bits);\
+        count++);
+    }
+}
+
+DENSITY_FORCE_INLINE bool density_chameleon_encode_copy_block(density_algorithm_state *const DENSITY_RESTRICT state, const uint8_t **DENSITY_RESTRICT in, uint8_t **DENSITY_RESTRICT out) {
+    if (DENSITY_UNLIKELY(!(state->counter & 0xf))) {
+        DENSITY_ALGORITHM_REDUCE_COPY_PENALTY_START;
+    }
+    state->counter++;
+    if (DENSITY_UNLIKELY(state->copy_penalty)) {
+        DENSITY_ALGORITHM_COPY(DENSITY_CHAMELEON_WORK_BLOCK_SIZE);
+        DENSITY_ALGORITHM_INCREASE_COPY_PENALTY_START;
+        return true;
+    }
+    return false;
+}
+
+DENSITY_FORCE_INLINE void density_chameleon_encode_close_block(density_algorithm_state *const DENSITY_RESTRICT state, const uint8_t *const out_start, const uint8_t *const out, density_chameleon_signature *const DENSITY_RESTRICT signature_pointer, const density_chameleon_signature signature) {
+#ifdef DENSITY_LITTLE_ENDIAN
+    DENSITY_MEMCPY(signature_pointer, &signature, sizeof(density_chameleon_signature));
+#elif defined(DENSITY_BIG_ENDIAN)
+    const density_chameleon_signature endian_signature = DENSITY_LITTLE_ENDIAN_64(signature);
+    DENSITY_MEMCPY(signature_pointer, &endian_signature, sizeof(density_chameleon_signature));
+#else
+#error
+#endif
+    DENSITY_ALGORITHM_TEST_INCOMPRESSIBILITY((out - out_start), DENSITY_CHAMELEON_WORK_BLOCK_SIZE);
+}
+
+#ifdef DENSITY_AVX2
+DENSITY_TARGET_AVX2 DENSITY_FORCE_INLINE void density_chameleon_encode_256_avx2(const uint8_t **DENSITY_RESTRICT in, uint8_t **DENSITY_RESTRICT out, density_chameleon_signature *const DENSITY_RESTRICT signature, density_chameleon_dictionary *const DENSITY_RESTRICT dictionary, density_algorithm_epochs *const DENSITY_RESTRICT epochs, const uint_fast8_t hash_bits) {
+    const __m256i multiplier = _mm256_set1_epi32((int) DENSITY_CHAMELEON_HASH_MULTIPLIER);
+    const __m256i lanes = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    uint32_t hashes[8];
+    uint32_t units[8];
+
+    for (uint_fast8_t group = 0; group < 8; group++) {
+        const __m256i unit = _mm256_loadu_si256((const __m256i *) *in);
+        const __m256i hash = _mm256_srli_epi32(_mm256_mullo_epi32(unit, multiplier), 32 - hash_bits);
+        _mm256_storeu_si256((__m256i *) hashes, hash);
+        _mm256_storeu_si256((__m256i *) units, unit);
+        if (epochs) {
+            for (uint_fast8_t lane = 0; lane < 8; lane++)
+                density_chameleon_dictionary_touch(dictionary, epochs, (uint_fast16_t) hashes[lane]);
+        }
+        __m256i reference = _mm256_i32gather_epi32((const int *) dictionary->entries, hash, sizeof(density_chameleon_dictionary_entry));
+
+        // Rotations by up to half the group compare every pair of lanes
+        __m256i conflicts = _mm256_setzero_si256();
+        for (uint_fast8_t distance = 1; distance <= 4; distance++)
+            conflicts = _mm256_or_si256(conflicts, _mm256_cmpeq_epi32(_mm256_permutevar8x32_epi32(hash, _mm256_sub_epi32(lanes, _mm256_set1_epi32(distance))), hash));
+
+        // A unit sharing its hash with an earlier unit of the group finds that unit in the dictionary, the nearest one being applied last
+        if (DENSITY_UNLIKELY(!_mm256_testz_si256(conflicts, conflicts))) {
+            for (uint_fast8_t distance = 7; distance; distance--) {
+                const __m256i source = _mm256_sub_epi32(lanes, _mm256_set1_epi32(distance));
+                const __m256i valid = _mm256_cmpgt_epi32(lanes, _mm256_set1_epi32(distance - 1));
+                const __m256i same = _mm256_and_si256(valid, _mm256_cmpeq_epi32(_mm256_permutevar8x32_epi32(hash, source), hash));
+                reference = _mm256_blendv_epi8(reference, _mm256_permutevar8x32_epi32(unit, source), same);
+            }
+        }
+        const __m256i match = _mm256_cmpeq_epi32(unit, reference);
+        const uint_fast8_t mask = (uint_fast8_t) _mm256_movemask_ps(_mm256_castsi256_ps(match));
+        *signature |= ((uint64_t) mask << (group << 3));
+
+        // Units are stored in order, so that the last unit of each hash remains
+        for (uint_fast8_t lane = 0; lane < 8; lane++)
+            dictionary->entries[hashes[lane]].as_uint32_t = units[lane];
+
+        const __m256i output = _mm256_blendv_epi8(unit, hash, match);
+        _mm_storeu_si128((__m128i *) *out, _mm_shuffle_epi8(_mm256_castsi256_si128(output), _mm_loadu_si128((const __m128i *) density_chameleon_encode_pack_shuffles[mask & 0xf])));
+        *out += density_chameleon_encode_pack_sizes[mask & 0xf];
+        _mm_storeu_si128((__m128i *) *out, _mm_shuffle_epi8(_mm256_extracti128_si256(output, 1), _mm_loadu_si128((const __m128i *) density_chameleon_encode_pack_shuffles[mask >> 4])));
+        *out += density_chameleon_encode_pack_sizes[mask >> 4];
+        *in += 8 * sizeof(uint32_t);
+    }
+}
+
+#define DENSITY_CHAMELEON_ENCODE_256_AVX2_INSTANCE(hash_bits)\
+    DENSITY_TARGET_AVX2 void density_chameleon_encode_256_avx2_##hash_bits(const uint8_t **DENSITY_RESTRICT in, uint8_t **DENSITY_RESTRICT out, density_chameleon_signature *const DENSITY_RESTRICT signature, density_chameleon_dictionary *const DENSITY_RESTRICT dictionary, density_algorithm_epochs *const DENSITY_RESTRICT epochs) {\
+        density_chameleon_encode_256_avx2(in, out, signature, dictionary, epochs, hash_bits);\
+    }
+
+DENSITY_CHAMELEON_ENCODE_256_AVX2_INSTANCE(12)
+DENSITY_CHAMELEON_ENCODE_256_AVX2_INSTANCE(13)
+DENSITY_CHAMELEON_ENCODE_256_AVX2_INSTANCE(14)
+DENSITY_CHAMELEON_ENCODE_256_AVX2_INSTANCE(15)
+DENSITY_CHAMELEON_ENCODE_256_AVX2_INSTANCE(16)
+
+void (*const density_chameleon_encode_256_avx2_instances[DENSITY_HASH_BITS_MAXIMUM - DENSITY_HASH_BITS_MINIMUM + 1])(const uint8_t **DENSITY_RESTRICT, uint8_t **DENSITY_RESTRICT, density_chameleon_signature *const DENSITY_RESTRICT, density_chameleon_dictionary *const DENSITY_RESTRICT, density_algorithm_epochs *const DENSITY_RESTRICT) = {
+        density_chameleon_encode_256_avx2_12,
+        density_chameleon_encode_256_avx2_13,
+        density_chameleon_encode_256_avx2_14,
+        density_chameleon_encode_256_avx2_15,
+        density_chameleon_encode_256_avx2_16
+};
+#endif
+
+DENSITY_FORCE_INLINE density_algorithm_exit_status density_chameleon_encode_with_epochs(density_algorithm_state *const DENSITY_RESTRICT state, const uint8_t **DENSITY_RESTRICT in, const uint_fast64_t in_size, uint8_t **DENSITY_RESTRICT out, const uint_fast64_t out_size, density_algorithm_epochs *const DENSITY_RESTRICT epochs, const bool update, const bool vectorized, const uint_fast8_t hash_bits) {
     if (out_size < DENSITY_CHAMELEON_MAXIMUM_COMPRESSED_UNIT_SIZE)
         return DENSITY_ALGORITHMS_EXIT_STATUS_OUTPUT_STALL;
 
@@ -106,27 +243,17 @@ DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE density_algorithm_exit_status densit
     uint_fast64_t limit_256 = (in_size >> 8);
 
     while (DENSITY_LIKELY(limit_256-- && *out <= out_limit)) {
-        if (DENSITY_UNLIKELY(!(state->counter & 0xf))) {
-            DENSITY_ALGORITHM_REDUCE_COPY_PENALTY_START;
-        }
-        state->counter++;
-        if (DENSITY_UNLIKELY(state->copy_penalty)) {
-            DENSITY_ALGORITHM_COPY(DENSITY_CHAMELEON_WORK_BLOCK_SIZE);
-            DENSITY_ALGORITHM_INCREASE_COPY_PENALTY_START;
-        } else {
+        if (!density_chameleon_encode_copy_block(state, in, out)) {
             const uint8_t *out_start = *out;
             density_chameleon_encode_prepare_signature(out, &signature_pointer, &signature);
             DENSITY_PREFETCH(*in + DENSITY_CHAMELEON_WORK_BLOCK_SIZE);
-            density_chameleon_encode_256(in, out, &signature, (density_chameleon_dictionary *const) state->dictionary, &unit);
-#ifdef DENSITY_LITTLE_ENDIAN
-            DENSITY_MEMCPY(signature_pointer, &signature, sizeof(density_chameleon_signature));
-#elif defined(DENSITY_BIG_ENDIAN)
-            const density_chameleon_signature endian_signature = DENSITY_LITTLE_ENDIAN_64(signature);
-            DENSITY_MEMCPY(signature_pointer, &endian_signature, sizeof(density_chameleon_signature));
-#else
-#error
+#ifdef DENSITY_AVX2
+            if (vectorized)
+                density_chameleon_encode_256_avx2_instances[hash_bits - DENSITY_HASH_BITS_MINIMUM](in, out, &signature, (density_chameleon_dictionary *const) state->dictionary, epochs);
+            else
 #endif
-            DENSITY_ALGORITHM_TEST_INCOMPRESSIBILITY((*out - out_start), DENSITY_CHAMELEON_WORK_BLOCK_SIZE);
+                density_chameleon_encode_256(in, out, &signature, (density_chameleon_dictionary *const) state->dictionary, epochs, update, &unit, hash_bits);
+            density_chameleon_encode_close_block(state, out_start, *out, signature_pointer, signature);
         }
     }
 
@@ -158,7 +285,7 @@ DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE density_algorithm_exit_status densit
     const uint_fast64_t limit_4 = (in_size & 0xff) >> 2;
     density_chameleon_encode_prepare_signature(out, &signature_pointer, &signature);
     for (uint_fast8_t shift = 0; shift != limit_4; shift++)
-        density_chameleon_encode_4(in, out, shift, &signature, (density_chameleon_dictionary *const) state->dictionary, &unit);
+        density_chameleon_encode_4(in, out, shift, &signature, (density_chameleon_dictionary *const) state->dictionary, epochs, update, &unit, hash_bits);
 
     signature |= ((uint64_t) DENSITY_CHAMELEON_SIGNATURE_FLAG_CHUNK << limit_4);    // End marker
 #ifdef DENSITY_LITTLE_ENDIAN
@@ -177,3 +304,85 @@ DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE density_algorithm_exit_status densit
 
     return DENSITY_ALGORITHMS_EXIT_STATUS_FINISHED;
 }
+
+DENSITY_FORCE_INLINE density_algorithm_exit_status density_chameleon_encode_pair_with_epochs(density_algorithm_state *const *DENSITY_RESTRICT states, const uint8_t **DENSITY_RESTRICT in, const uint_fast64_t *DENSITY_RESTRICT in_size, uint8_t **DENSITY_RESTRICT out, const uint_fast64_t *DENSITY_RESTRICT out_size, density_algorithm_epochs *const DENSITY_RESTRICT epochs_a, density_algorithm_epochs *const DENSITY_RESTRICT epochs_b, const uint_fast8_t hash_bits) {
+    const uint8_t *const in_start[2] = {in[0], in[1]};
+    uint8_t *const out_start[2] = {out[0], out[1]};
+    density_chameleon_signature signature_a;
+    density_chameleon_signature signature_b;
+    density_chameleon_signature *signature_pointer_a;
+    density_chameleon_signature *signature_pointer_b;
+    uint32_t unit;
+
+    // Work blocks both streams have are encoded in lockstep, exactly as each stream alone would encode them
+    if (out_size[0] >= DENSITY_CHAMELEON_MAXIMUM_COMPRESSED_UNIT_SIZE && out_size[1] >= DENSITY_CHAMELEON_MAXIMUM_COMPRESSED_UNIT_SIZE) {
+        const uint8_t *const out_limit_a = out[0] + out_size[0] - DENSITY_CHAMELEON_MAXIMUM_COMPRESSED_UNIT_SIZE;
+        const uint8_t *const out_limit_b = out[1] + out_size[1] - DENSITY_CHAMELEON_MAXIMUM_COMPRESSED_UNIT_SIZE;
+        uint_fast64_t limit_256 = (in_size[0] < in_size[1] ? in_size[0] : in_size[1]) >> 8;
+
+        while (DENSITY_LIKELY(limit_256-- && out[0] <= out_limit_a && out[1] <= out_limit_b)) {
+            const bool copied_a = density_chameleon_encode_copy_block(states[0], &in[0], &out[0]);
+            const bool copied_b = density_chameleon_encode_copy_block(states[1], &in[1], &out[1]);
+            const uint8_t *const block_start_a = out[0];
+            const uint8_t *const block_start_b = out[1];
+            if (DENSITY_LIKELY(!copied_a && !copied_b)) {
+                density_chameleon_encode_prepare_signature(&out[0], &signature_pointer_a, &signature_a);
+                density_chameleon_encode_prepare_signature(&out[1], &signature_pointer_b, &signature_b);
+                DENSITY_PREFETCH(in[0] + DENSITY_CHAMELEON_WORK_BLOCK_SIZE);
+                DENSITY_PREFETCH(in[1] + DENSITY_CHAMELEON_WORK_BLOCK_SIZE);
+                density_chameleon_encode_256_pair(&in[0], &out[0], &signature_a, (density_chameleon_dictionary *const) states[0]->dictionary, epochs_a, &in[1], &out[1], &signature_b, (density_chameleon_dictionary *const) states[1]->dictionary, epochs_b, hash_bits);
+                density_chameleon_encode_close_block(states[0], block_start_a, out[0], signature_pointer_a, signature_a);
+                density_chameleon_encode_close_block(states[1], block_start_b, out[1], signature_pointer_b, signature_b);
+            } else if (!copied_a) {
+                density_chameleon_encode_prepare_signature(&out[0], &signature_pointer_a, &signature_a);
+                density_chameleon_encode_256(&in[0], &out[0], &signature_a, (density_chameleon_dictionary *const) states[0]->dictionary, epochs_a, true, &unit, hash_bits);
+                density_chameleon_encode_close_block(states[0], block_start_a, out[0], signature_pointer_a, signature_a);
+            } else if (!copied_b) {
+                density_chameleon_encode_prepare_signature(&out[1], &signature_pointer_b, &signature_b);
+                density_chameleon_encode_256(&in[1], &out[1], &signature_b, (density_chameleon_dictionary *const) states[1]->dictionary, epochs_b, true, &unit, hash_bits);
+                density_chameleon_encode_close_block(states[1], block_start_b, out[1], signature_pointer_b, signature_b);
+            }
+        }
+    }
+
+    // Each stream then finishes on its own, from where the lockstep left it
+    const density_algorithm_exit_status status_a = density_chameleon_encode_with_epochs(states[0], &in[0], in_size[0] - (in[0] - in_start[0]), &out[0], out_size[0] - (out[0] - out_start[0]), epochs_a, true, false, hash_bits);
+    const density_algorithm_exit_status status_b = density_chameleon_encode_with_epochs(states[1], &in[1], in_size[1] - (in[1] - in_start[1]), &out[1], out_size[1] - (out[1] - out_start[1]), epochs_b, true, false, hash_bits);
+    return status_a ? status_a : status_b;
+}
+
+DENSITY_FORCE_INLINE density_algorithm_exit_status density_chameleon_encode_specialized(density_algorithm_state *const DENSITY_RESTRICT state, const uint8_t **DENSITY_RESTRICT in, const uint_fast64_t in_size, uint8_t **DENSITY_RESTRICT out, const uint_fast64_t out_size, const bool vectorized) {
+    if (DENSITY_ALGORITHMS_DEFAULT_CASE(state))
+        return density_chameleon_encode_with_epochs(state, in, in_size, out, out_size, NULL, true, vectorized, DENSITY_HASH_BITS_DEFAULT);
+    if (!DENSITY_ALGORITHMS_VALID_HASH_BITS(state->hash_bits))
+        return DENSITY_ALGORITHMS_EXIT_STATUS_ERROR_DURING_PROCESSING;
+    return density_chameleon_encode_with_epochs(state, in, in_size, out, out_size, DENSITY_ALGORITHMS_EPOCHS(state), !state->static_dictionary, vectorized && !state->static_dictionary, state->hash_bits);
+}
+
+DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE density_algorithm_exit_status density_chameleon_encode(density_algorithm_state *const DENSITY_RESTRICT state, const uint8_t **DENSITY_RESTRICT in, const uint_fast64_t in_size, uint8_t **DENSITY_RESTRICT out, const uint_fast64_t out_size) {
+#ifdef __AVX2__
+    return density_chameleon_encode_specialized(state, in, in_size, out, out_size, true);
+#else
+    return density_chameleon_encode_specialized(state, in, in_size, out, out_size, false);
+#endif
+}
+
+DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE density_algorithm_exit_status density_chameleon_encode_pair(density_algorithm_state *const *DENSITY_RESTRICT states, const uint8_t **DENSITY_RESTRICT in, const uint_fast64_t *DENSITY_RESTRICT in_size, uint8_t **DENSITY_RESTRICT out, const uint_fast64_t *DENSITY_RESTRICT out_size) {
+    if (states[0]->hash_bits != states[1]->hash_bits || !DENSITY_ALGORITHMS_EPOCHS(states[0]) != !DENSITY_ALGORITHMS_EPOCHS(states[1]) || states[0]->static_dictionary || states[1]->static_dictionary)
+        return DENSITY_ALGORITHMS_EXIT_STATUS_ERROR_DURING_PROCESSING;
+    if (DENSITY_ALGORITHMS_DEFAULT_CASE(states[0]))
+        return density_chameleon_encode_pair_with_epochs(states, in, in_size, out, out_size, NULL, NULL, DENSITY_HASH_BITS_DEFAULT);
+    if (!DENSITY_ALGORITHMS_VALID_HASH_BITS(states[0]->hash_bits))
+        return DENSITY_ALGORITHMS_EXIT_STATUS_ERROR_DURING_PROCESSING;
+    return density_chameleon_encode_pair_with_epochs(states, in, in_size, out, out_size, DENSITY_ALGORITHMS_EPOCHS(states[0]), DENSITY_ALGORITHMS_EPOCHS(states[1]), states[0]->hash_bits);
+}
+
+#ifdef DENSITY_DISPATCH
+DENSITY_FORCE_INLINE density_algorithm_exit_status density_chameleon_encode_vectorized(density_algorithm_state *const DENSITY_RESTRICT state, const uint8_t **DENSITY_RESTRICT in, const uint_fast64_t in_size, uint8_t **DENSITY_RESTRICT out, const uint_fast64_t out_size) {
+    return density_chameleon_encode_specialized(state, in, in_size, out, out_size, true);
+}
+
+DENSITY_ALGORITHMS_KERNEL_VARIANT(density_chameleon_encode, sse4_2, DENSITY_TARGET_SSE4_2, density_chameleon_encode)
+DENSITY_ALGORITHMS_KERNEL_VARIANT(density_chameleon_encode, avx2, DENSITY_TARGET_AVX2, density_chameleon_encode_vectorized)
+DENSITY_ALGORITHMS_KERNEL_VARIANT(density_chameleon_encode, avx512, DENSITY_TARGET_AVX512, density_chameleon_encode_vectorized)
+#endif
@@ -49,5 +49,8 @@
 #include "../../algorithms.h"
 
 DENSITY_WINDOWS_EXPORT density_algorithm_exit_status density_chameleon_encode(density_algorithm_state *const DENSITY_RESTRICT_DECLARE, const uint8_t **DENSITY_RESTRICT_DECLARE, const uint_fast64_t, uint8_t **DENSITY_RESTRICT_DECLARE, const uint_fast64_t);
+DENSITY_WINDOWS_EXPORT density_algorithm_exit_status density_chameleon_encode_pair(density_algorithm_state *const *DENSITY_RESTRICT_DECLARE, const uint8_t **DENSITY_RESTRICT_DECLARE, const uint_fast64_t *DENSITY_RESTRICT_DECLARE, uint8_t **DENSITY_RESTRICT_DECLARE, const uint_fast64_t *DENSITY_RESTRICT_DECLARE);
+
+DENSITY_ALGORITHMS_KERNEL_VARIANTS_PROTOTYPES(density_chameleon_encode)
 
 #endif
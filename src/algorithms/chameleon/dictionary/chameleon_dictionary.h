@@ -46,6 +46,7 @@
 #define DENSITY_CHAMELEON_DICTIONARY_H
 
 #include "../chameleon.h"
+#include "../../algorithms.h"
 
 #include <string.h>
 
@@ -55,9 +56,16 @@ typedef struct {
     uint32_t as_uint32_t;
 } density_chameleon_dictionary_entry;
 
+/*
+ * Only the first 1 << hash_bits entries are allocated
+ */
 typedef struct {
-    density_chameleon_dictionary_entry entries[1 << DENSITY_CHAMELEON_HASH_BITS];
+    density_chameleon_dictionary_entry entries[1 << DENSITY_HASH_BITS_MAXIMUM];
 } density_chameleon_dictionary;
 #pragma pack(pop)
 
+DENSITY_WINDOWS_EXPORT size_t density_chameleon_dictionary_size(const uint_fast8_t);
+
+DENSITY_WINDOWS_EXPORT void density_chameleon_dictionary_touch(density_chameleon_dictionary *const DENSITY_RESTRICT_DECLARE, density_algorithm_epochs *const DENSITY_RESTRICT_DECLARE, const uint_fast16_t);
+
 #endif
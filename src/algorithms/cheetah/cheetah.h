@@ -48,10 +48,9 @@
 
 #include "../../globals.h"
 
-#define DENSITY_CHEETAH_HASH_BITS                                           16
 #define DENSITY_CHEETAH_HASH_MULTIPLIER                                     (uint32_t)0x9D6EF916lu
 
-#define DENSITY_CHEETAH_HASH_ALGORITHM(value32)                             (uint16_t)(value32 * DENSITY_CHEETAH_HASH_MULTIPLIER >> (32 - DENSITY_CHEETAH_HASH_BITS))
+#define DENSITY_CHEETAH_HASH_ALGORITHM(value32, hash_bits)                  (uint16_t)(value32 * DENSITY_CHEETAH_HASH_MULTIPLIER >> (32 - (hash_bits)))
 
 typedef enum {
     DENSITY_CHEETAH_SIGNATURE_FLAG_PREDICTED = 0x0,
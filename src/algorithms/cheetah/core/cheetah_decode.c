@@ -45,63 +45,79 @@
 
 #include "cheetah_decode.h"
 
-DENSITY_FORCE_INLINE void density_cheetah_decode_process_predicted(uint8_t **DENSITY_RESTRICT out, uint_fast16_t *DENSITY_RESTRICT last_hash, density_cheetah_dictionary *const DENSITY_RESTRICT dictionary) {
-    const uint32_t unit = dictionary->prediction_entries[*last_hash].next_chunk_prediction;
+DENSITY_FORCE_INLINE void density_cheetah_decode_process_predicted(uint8_t **DENSITY_RESTRICT out, uint_fast16_t *DENSITY_RESTRICT last_hash, density_cheetah_dictionary *const DENSITY_RESTRICT dictionary, density_algorithm_epochs *const DENSITY_RESTRICT epochs, const uint_fast8_t hash_bits) {
+    const uint32_t unit = density_cheetah_dictionary_predictions(dictionary, hash_bits)[*last_hash].next_chunk_prediction;
     DENSITY_MEMCPY(*out, &unit, sizeof(uint32_t));
-    *last_hash = DENSITY_CHEETAH_HASH_ALGORITHM(DENSITY_LITTLE_ENDIAN_32(unit));
+    *last_hash = DENSITY_CHEETAH_HASH_ALGORITHM(DENSITY_LITTLE_ENDIAN_32(unit), hash_bits);
+    if (epochs)
+        density_cheetah_dictionary_touch(dictionary, epochs, (uint_fast16_t) *last_hash, hash_bits);
 }
 
-DENSITY_FORCE_INLINE void density_cheetah_decode_process_compressed_a(uint8_t **DENSITY_RESTRICT out, uint_fast16_t *DENSITY_RESTRICT last_hash, density_cheetah_dictionary *const DENSITY_RESTRICT dictionary, const uint16_t hash) {
-    DENSITY_PREFETCH(&dictionary->prediction_entries[hash]);
+DENSITY_FORCE_INLINE void density_cheetah_decode_process_compressed_a(uint8_t **DENSITY_RESTRICT out, uint_fast16_t *DENSITY_RESTRICT last_hash, density_cheetah_dictionary *const DENSITY_RESTRICT dictionary, density_algorithm_epochs *const DENSITY_RESTRICT epochs, const bool update, const uint16_t read_hash, const uint_fast8_t hash_bits) {
+    const uint16_t hash = (uint16_t) (read_hash & ((1 << hash_bits) - 1));  // Keeps corrupted input within the dictionary
+    DENSITY_PREFETCH(&density_cheetah_dictionary_predictions(dictionary, hash_bits)[hash]);
+    if (epochs)
+        density_cheetah_dictionary_touch(dictionary, epochs, hash, hash_bits);
     const uint32_t unit = dictionary->entries[hash].chunk_a;
     DENSITY_MEMCPY(*out, &unit, sizeof(uint32_t));
-    dictionary->prediction_entries[*last_hash].next_chunk_prediction = unit;
+    if (update)
+        density_cheetah_dictionary_predictions(dictionary, hash_bits)[*last_hash].next_chunk_prediction = unit;
     *last_hash = hash;
 }
 
-DENSITY_FORCE_INLINE void density_cheetah_decode_process_compressed_b(uint8_t **DENSITY_RESTRICT out, uint_fast16_t *DENSITY_RESTRICT last_hash, density_cheetah_dictionary *const DENSITY_RESTRICT dictionary, const uint16_t hash) {
-    DENSITY_PREFETCH(&dictionary->prediction_entries[hash]);
+DENSITY_FORCE_INLINE void density_cheetah_decode_process_compressed_b(uint8_t **DENSITY_RESTRICT out, uint_fast16_t *DENSITY_RESTRICT last_hash, density_cheetah_dictionary *const DENSITY_RESTRICT dictionary, density_algorithm_epochs *const DENSITY_RESTRICT epochs, const bool update, const uint16_t read_hash, const uint_fast8_t hash_bits) {
+    const uint16_t hash = (uint16_t) (read_hash & ((1 << hash_bits) - 1));  // Keeps corrupted input within the dictionary
+    DENSITY_PREFETCH(&density_cheetah_dictionary_predictions(dictionary, hash_bits)[hash]);
+    if (epochs)
+        density_cheetah_dictionary_touch(dictionary, epochs, hash, hash_bits);
     density_cheetah_dictionary_entry *const entry = &dictionary->entries[hash];
     const uint32_t unit = entry->chunk_b;
-    entry->chunk_b = entry->chunk_a;
-    entry->chunk_a = unit;  // Does not ensure dictionary content consistency between endiannesses
+    if (update) {
+        entry->chunk_b = entry->chunk_a;
+        entry->chunk_a = unit;  // Does not ensure dictionary content consistency between endiannesses
+    }
     DENSITY_MEMCPY(*out, &unit, sizeof(uint32_t));
-    dictionary->prediction_entries[*last_hash].next_chunk_prediction = unit;
+    if (update)
+        density_cheetah_dictionary_predictions(dictionary, hash_bits)[*last_hash].next_chunk_prediction = unit;
     *last_hash = hash;
 }
 
-DENSITY_FORCE_INLINE void density_cheetah_decode_process_uncompressed(uint8_t **DENSITY_RESTRICT out, uint_fast16_t *DENSITY_RESTRICT last_hash, density_cheetah_dictionary *const DENSITY_RESTRICT dictionary, const uint32_t unit) {
-    const uint16_t hash = DENSITY_CHEETAH_HASH_ALGORITHM(DENSITY_LITTLE_ENDIAN_32(unit));
-    DENSITY_PREFETCH(&dictionary->prediction_entries[hash]);
-    density_cheetah_dictionary_entry *const entry = &dictionary->entries[hash];
-    entry->chunk_b = entry->chunk_a;
-    entry->chunk_a = unit;  // Does not ensure dictionary content consistency between endiannesses
+DENSITY_FORCE_INLINE void density_cheetah_decode_process_uncompressed(uint8_t **DENSITY_RESTRICT out, uint_fast16_t *DENSITY_RESTRICT last_hash, density_cheetah_dictionary *const DENSITY_RESTRICT dictionary, density_algorithm_epochs *const DENSITY_RESTRICT epochs, const bool update, const uint32_t unit, const uint_fast8_t hash_bits) {
+    const uint16_t hash = DENSITY_CHEETAH_HASH_ALGORITHM(DENSITY_LITTLE_ENDIAN_32(unit), hash_bits);
+    DENSITY_PREFETCH(&density_cheetah_dictionary_predictions(dictionary, hash_bits)[hash]);
+    if (epochs)
+        density_cheetah_dictionary_touch(dictionary, epochs, hash, hash_bits);
+    if (update) {
+        density_cheetah_dictionary_entry *const entry = &dictionary->entries[hash];
+        entry->chunk_b = entry->chunk_a;
+        entry->chunk_a = unit;  // Does not ensure dictionary content consistency between endiannesses
+        density_cheetah_dictionary_predictions(dictionary, hash_bits)[*last_hash].next_chunk_prediction = unit;    // Does not ensure dictionary content consistency between endiannesses
+    }
     DENSITY_MEMCPY(*out, &unit, sizeof(uint32_t));
-    dictionary->prediction_entries[*last_hash].next_chunk_prediction = unit;    // Does not ensure dictionary content consistency between endiannesses
     *last_hash = hash;
 }
 
-DENSITY_FORCE_INLINE void density_cheetah_decode_kernel_4(const uint8_t **DENSITY_RESTRICT in, uint8_t **DENSITY_RESTRICT out, uint_fast16_t *DENSITY_RESTRICT last_hash, const uint8_t flag, density_cheetah_dictionary *const DENSITY_RESTRICT dictionary) {
+DENSITY_FORCE_INLINE void density_cheetah_decode_kernel_4(const uint8_t **DENSITY_RESTRICT in, uint8_t **DENSITY_RESTRICT out, uint_fast16_t *DENSITY_RESTRICT last_hash, const uint8_t flag, density_cheetah_dictionary *const DENSITY_RESTRICT dictionary, density_algorithm_epochs *const DENSITY_RESTRICT epochs, const bool update, const uint_fast8_t hash_bits) {
     uint16_t hash;
     uint32_t unit;
 
     switch (flag) {
         case DENSITY_CHEETAH_SIGNATURE_FLAG_PREDICTED:
-            density_cheetah_decode_process_predicted(out, last_hash, dictionary);
+            density_cheetah_decode_process_predicted(out, last_hash, dictionary, epochs, hash_bits);
             break;
         case DENSITY_CHEETAH_SIGNATURE_FLAG_MAP_A:
             DENSITY_MEMCPY(&hash, *in, sizeof(uint16_t));
-            density_cheetah_decode_process_compressed_a(out, last_hash, dictionary, DENSITY_LITTLE_ENDIAN_16(hash));
+            density_cheetah_decode_process_compressed_a(out, last_hash, dictionary, epochs, update, DENSITY_LITTLE_ENDIAN_16(hash), hash_bits);
             *in += sizeof(uint16_t);
             break;
         case DENSITY_CHEETAH_SIGNATURE_FLAG_MAP_B:
             DENSITY_MEMCPY(&hash, *in, sizeof(uint16_t));
-            density_cheetah_decode_process_compressed_b(out, last_hash, dictionary, DENSITY_LITTLE_ENDIAN_16(hash));
+            density_cheetah_decode_process_compressed_b(out, last_hash, dictionary, epochs, update, DENSITY_LITTLE_ENDIAN_16(hash), hash_bits);
             *in += sizeof(uint16_t);
             break;
         default:    // DENSITY_CHEETAH_SIGNATURE_FLAG_CHUNK
             DENSITY_MEMCPY(&unit, *in, sizeof(uint32_t));
-            density_cheetah_decode_process_uncompressed(out, last_hash, dictionary, unit);
+            density_cheetah_decode_process_uncompressed(out, last_hash, dictionary, epochs, update, unit, hash_bits);
             *in += sizeof(uint32_t);
             break;
     }
@@ -109,24 +125,24 @@ DENSITY_FORCE_INLINE void density_cheetah_decode_kernel_4(const uint8_t **DENSIT
     *out += sizeof(uint32_t);
 }
 
-DENSITY_FORCE_INLINE void density_cheetah_decode_kernel_16(const uint8_t **DENSITY_RESTRICT in, uint8_t **DENSITY_RESTRICT out, uint_fast16_t *DENSITY_RESTRICT last_hash, const uint8_t flags, density_cheetah_dictionary *const DENSITY_RESTRICT dictionary) {
+DENSITY_FORCE_INLINE void density_cheetah_decode_kernel_16(const uint8_t **DENSITY_RESTRICT in, uint8_t **DENSITY_RESTRICT out, uint_fast16_t *DENSITY_RESTRICT last_hash, const uint8_t flags, density_cheetah_dictionary *const DENSITY_RESTRICT dictionary, density_algorithm_epochs *const DENSITY_RESTRICT epochs, const bool update, const uint_fast8_t hash_bits) {
     uint16_t hash;
     uint32_t unit;
 
     switch (flags) {
         DENSITY_CASE_GENERATOR_4_4_COMBINED(\
-            density_cheetah_decode_process_predicted(out, last_hash, dictionary);, \
+            density_cheetah_decode_process_predicted(out, last_hash, dictionary, epochs, hash_bits);, \
             DENSITY_CHEETAH_SIGNATURE_FLAG_PREDICTED, \
             DENSITY_MEMCPY(&hash, *in, sizeof(uint16_t)); \
-            density_cheetah_decode_process_compressed_a(out, last_hash, dictionary, DENSITY_LITTLE_ENDIAN_16(hash));\
+            density_cheetah_decode_process_compressed_a(out, last_hash, dictionary, epochs, update, DENSITY_LITTLE_ENDIAN_16(hash), hash_bits);\
             *in += sizeof(uint16_t);, \
             DENSITY_CHEETAH_SIGNATURE_FLAG_MAP_A, \
             DENSITY_MEMCPY(&hash, *in, sizeof(uint16_t)); \
-            density_cheetah_decode_process_compressed_b(out, last_hash, dictionary, DENSITY_LITTLE_ENDIAN_16(hash));\
+            density_cheetah_decode_process_compressed_b(out, last_hash, dictionary, epochs, update, DENSITY_LITTLE_ENDIAN_16(hash), hash_bits);\
             *in += sizeof(uint16_t);, \
             DENSITY_CHEETAH_SIGNATURE_FLAG_MAP_B, \
             DENSITY_MEMCPY(&unit, *in, sizeof(uint32_t)); \
-            density_cheetah_decode_process_uncompressed(out, last_hash, dictionary, unit);\
+            density_cheetah_decode_process_uncompressed(out, last_hash, dictionary, epochs, update, unit, hash_bits);\
             *in += sizeof(uint32_t);, \
             DENSITY_CHEETAH_SIGNATURE_FLAG_CHUNK, \
             *out += sizeof(uint32_t);, \
@@ -143,24 +159,29 @@ DENSITY_FORCE_INLINE uint8_t density_cheetah_decode_read_flag(const density_chee
     return (uint8_t const) ((signature >> shift) & 0x3);
 }
 
-DENSITY_FORCE_INLINE void density_cheetah_decode_4(const uint8_t **DENSITY_RESTRICT in, uint8_t **DENSITY_RESTRICT out, uint_fast16_t *DENSITY_RESTRICT last_hash, const density_cheetah_signature signature, const uint_fast8_t shift, density_cheetah_dictionary *const DENSITY_RESTRICT dictionary) {
-    density_cheetah_decode_kernel_4(in, out, last_hash, density_cheetah_decode_read_flag(signature, shift), dictionary);
+DENSITY_FORCE_INLINE void density_cheetah_decode_4(const uint8_t **DENSITY_RESTRICT in, uint8_t **DENSITY_RESTRICT out, uint_fast16_t *DENSITY_RESTRICT last_hash, const density_cheetah_signature signature, const uint_fast8_t shift, density_cheetah_dictionary *const DENSITY_RESTRICT dictionary, density_algorithm_epochs *const DENSITY_RESTRICT epochs, const bool update, const uint_fast8_t hash_bits) {
+    density_cheetah_decode_kernel_4(in, out, last_hash, density_cheetah_decode_read_flag(signature, shift), dictionary, epochs, update, hash_bits);
 }
 
-DENSITY_FORCE_INLINE void density_cheetah_decode_16(const uint8_t **DENSITY_RESTRICT in, uint8_t **DENSITY_RESTRICT out, uint_fast16_t *DENSITY_RESTRICT last_hash, const density_cheetah_signature signature, const uint_fast8_t shift, density_cheetah_dictionary *const DENSITY_RESTRICT dictionary) {
-    density_cheetah_decode_kernel_16(in, out, last_hash, (uint8_t const) ((signature >> shift) & 0xff), dictionary);
+DENSITY_FORCE_INLINE void density_cheetah_decode_16(const uint8_t **DENSITY_RESTRICT in, uint8_t **DENSITY_RESTRICT out, uint_fast16_t *DENSITY_RESTRICT last_hash, const density_cheetah_signature signature, const uint_fast8_t shift, density_cheetah_dictionary *const DENSITY_RESTRICT dictionary, density_algorithm_epochs *const DENSITY_RESTRICT epochs, const bool update, const uint_fast8_t hash_bits) {
+    density_cheetah_decode_kernel_16(in, out, last_hash, (uint8_t const) ((signature >> shift) & 0xff), dictionary, epochs, update, hash_bits);
 }
 
-DENSITY_FORCE_INLINE void density_cheetah_decode_128(const uint8_t **DENSITY_RESTRICT in, uint8_t **DENSITY_RESTRICT out, uint_fast16_t *DENSITY_RESTRICT last_hash, const density_cheetah_signature signature, density_cheetah_dictionary *const DENSITY_RESTRICT dictionary) {
+DENSITY_FORCE_INLINE void density_cheetah_decode_128(const uint8_t **DENSITY_RESTRICT in, uint8_t **DENSITY_RESTRICT out, uint_fast16_t *DENSITY_RESTRICT last_hash, const density_cheetah_signature signature, density_cheetah_dictionary *const DENSITY_RESTRICT dictionary, density_algorithm_epochs *const DENSITY_RESTRICT epochs, const bool update, const bool combined, const uint_fast8_t hash_bits) {
+    if (!combined) {    // One unit at a time, which keeps the run time parameterized instance small
+        for (uint_fast8_t shift = 0; shift < density_bitsizeof(density_cheetah_signature); shift += 2)
+            density_cheetah_decode_4(in, out, last_hash, signature, shift, dictionary, epochs, update, hash_bits);
+        return;
+    }
 #ifdef __clang__
     uint_fast8_t count = 0;
     for (uint_fast8_t count_b = 0; count_b < 8; count_b ++) {
-        density_cheetah_decode_16(in, out, last_hash, signature, count, dictionary);
+        density_cheetah_decode_16(in, out, last_hash, signature, count, dictionary, epochs, update, hash_bits);
         count += 8;
     }
 #else
     for (uint_fast8_t count_b = 0; count_b < density_bitsizeof(density_cheetah_signature); count_b += 8)
-        density_cheetah_decode_16(in, out, last_hash, signature, count_b, dictionary);
+        density_cheetah_decode_16(in, out, last_hash, signature, count_b, dictionary, epochs, update, hash_bits);
 #endif
 }
 
@@ -177,18 +198,21 @@ DENSITY_FORCE_INLINE void density_cheetah_decode_read_signature(const uint8_t **
     *in += sizeof(density_cheetah_signature);
 }
 
-DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE density_algorithm_exit_status density_cheetah_decode(density_algorithm_state *const DENSITY_RESTRICT state, const uint8_t **DENSITY_RESTRICT in, const uint_fast64_t in_size, uint8_t **DENSITY_RESTRICT out, const uint_fast64_t out_size) {
+DENSITY_FORCE_INLINE density_algorithm_exit_status density_cheetah_decode_with_epochs(density_algorithm_state *const DENSITY_RESTRICT state, const uint8_t **DENSITY_RESTRICT in, const uint_fast64_t in_size, uint8_t **DENSITY_RESTRICT out, const uint_fast64_t out_size, density_algorithm_epochs *const DENSITY_RESTRICT epochs, const bool update, const bool combined, const uint_fast8_t hash_bits) {
     if (out_size < DENSITY_CHEETAH_DECOMPRESSED_UNIT_SIZE)
         return DENSITY_ALGORITHMS_EXIT_STATUS_OUTPUT_STALL;
 
     density_cheetah_signature signature;
     uint_fast8_t shift;
     uint_fast64_t remaining;
-    uint_fast16_t last_hash = 0;
+    uint_fast16_t last_hash = state->last_hash;
     uint8_t flag;
 
     const uint8_t *start = *in;
 
+    if (epochs)
+        density_cheetah_dictionary_touch((density_cheetah_dictionary *const) state->dictionary, epochs, last_hash, hash_bits);
+
     if (in_size < DENSITY_CHEETAH_MAXIMUM_COMPRESSED_UNIT_SIZE) {
         goto read_signature;
     }
@@ -207,13 +231,15 @@ DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE density_algorithm_exit_status densit
         } else {
             const uint8_t *in_start = *in;
             density_cheetah_decode_read_signature(in, &signature);
-            density_cheetah_decode_128(in, out, &last_hash, signature, (density_cheetah_dictionary *const) state->dictionary);
+            density_cheetah_decode_128(in, out, &last_hash, signature, (density_cheetah_dictionary *const) state->dictionary, epochs, update, combined, hash_bits);
             DENSITY_ALGORITHM_TEST_INCOMPRESSIBILITY((*in - in_start), DENSITY_CHEETAH_WORK_BLOCK_SIZE);
         }
     }
 
-    if (*out > out_limit)
+    if (*out > out_limit) {
+        state->last_hash = last_hash;   // Decoding can resume from the next signature with more room
         return DENSITY_ALGORITHMS_EXIT_STATUS_OUTPUT_STALL;
+    }
 
     read_signature:
     if (in_size - (*in - start) < sizeof(density_cheetah_signature))
@@ -228,7 +254,7 @@ DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE density_algorithm_exit_status densit
                 case DENSITY_CHEETAH_SIGNATURE_FLAG_CHUNK:
                     goto process_remaining_bytes;   // End marker
                 case DENSITY_CHEETAH_SIGNATURE_FLAG_PREDICTED:
-                    density_cheetah_decode_kernel_4(in, out, &last_hash, DENSITY_CHEETAH_SIGNATURE_FLAG_PREDICTED, (density_cheetah_dictionary *const) state->dictionary);
+                    density_cheetah_decode_kernel_4(in, out, &last_hash, DENSITY_CHEETAH_SIGNATURE_FLAG_PREDICTED, (density_cheetah_dictionary *const) state->dictionary, epochs, update, hash_bits);
                     shift += 2;
                     break;
                 default:
@@ -242,13 +268,13 @@ DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE density_algorithm_exit_status densit
                 case DENSITY_CHEETAH_SIGNATURE_FLAG_CHUNK:
                     goto process_remaining_bytes;   // End marker
                 default:
-                    density_cheetah_decode_kernel_4(in, out, &last_hash, flag, (density_cheetah_dictionary *const) state->dictionary);
+                    density_cheetah_decode_kernel_4(in, out, &last_hash, flag, (density_cheetah_dictionary *const) state->dictionary, epochs, update, hash_bits);
                     shift += 2;
                     break;
             }
             break;
         default:
-            density_cheetah_decode_4(in, out, &last_hash, signature, shift, (density_cheetah_dictionary *const) state->dictionary);
+            density_cheetah_decode_4(in, out, &last_hash, signature, shift, (density_cheetah_dictionary *const) state->dictionary, epochs, update, hash_bits);
             shift += 2;
             break;
     }
@@ -262,5 +288,16 @@ DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE density_algorithm_exit_status densit
     remaining = in_size - (*in - start);
     DENSITY_ALGORITHM_COPY(remaining);
 
+    state->last_hash = last_hash;
     return DENSITY_ALGORITHMS_EXIT_STATUS_FINISHED;
 }
+
+DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE density_algorithm_exit_status density_cheetah_decode(density_algorithm_state *const DENSITY_RESTRICT state, const uint8_t **DENSITY_RESTRICT in, const uint_fast64_t in_size, uint8_t **DENSITY_RESTRICT out, const uint_fast64_t out_size) {
+    if (DENSITY_ALGORITHMS_DEFAULT_CASE(state))
+        return density_cheetah_decode_with_epochs(state, in, in_size, out, out_size, NULL, true, true, DENSITY_HASH_BITS_DEFAULT);
+    if (!DENSITY_ALGORITHMS_VALID_HASH_BITS(state->hash_bits))
+        return DENSITY_ALGORITHMS_EXIT_STATUS_ERROR_DURING_PROCESSING;
+    return density_cheetah_decode_with_epochs(state, in, in_size, out, out_size, DENSITY_ALGORITHMS_EPOCHS(state), !state->static_dictionary, false, state->hash_bits);
+}
+
+DENSITY_ALGORITHMS_KERNEL_VARIANTS(density_cheetah_decode)
@@ -51,8 +51,10 @@ DENSITY_FORCE_INLINE void density_cheetah_encode_prepare_signature(uint8_t **DEN
     *out += sizeof(density_cheetah_signature);
 }
 
-DENSITY_FORCE_INLINE void density_cheetah_encode_kernel(uint8_t **DENSITY_RESTRICT out, uint_fast16_t *DENSITY_RESTRICT last_hash, const uint_fast16_t hash, const uint_fast8_t shift, density_cheetah_signature *const DENSITY_RESTRICT signature, density_cheetah_dictionary *const DENSITY_RESTRICT dictionary, uint32_t *DENSITY_RESTRICT unit) {
-    uint32_t *predictedChunk = (uint32_t*) &dictionary->prediction_entries[*last_hash];
+DENSITY_FORCE_INLINE void density_cheetah_encode_kernel(uint8_t **DENSITY_RESTRICT out, uint_fast16_t *DENSITY_RESTRICT last_hash, const uint_fast16_t hash, const uint_fast8_t shift, density_cheetah_signature *const DENSITY_RESTRICT signature, density_cheetah_dictionary *const DENSITY_RESTRICT dictionary, density_algorithm_epochs *const DENSITY_RESTRICT epochs, const bool update, uint32_t *DENSITY_RESTRICT unit, const uint_fast8_t hash_bits) {
+    if (epochs)
+        density_cheetah_dictionary_touch(dictionary, epochs, hash, hash_bits);
+    uint32_t *predictedChunk = (uint32_t*) &density_cheetah_dictionary_predictions(dictionary, hash_bits)[*last_hash];
 
     if (*predictedChunk ^ *unit) {
         density_cheetah_dictionary_entry *found = &dictionary->entries[hash];
@@ -75,8 +77,10 @@ DENSITY_FORCE_INLINE void density_cheetah_encode_kernel(uint8_t **DENSITY_RESTRI
 #endif
                 *out += sizeof(uint16_t);
             }
-            *found_b = *found_a;
-            *found_a = *unit;   // Does not ensure dictionary content consistency between endiannesses
+            if (update) {
+                *found_b = *found_a;
+                *found_a = *unit;   // Does not ensure dictionary content consistency between endiannesses
+            }
         } else {
             *signature |= ((uint64_t) DENSITY_CHEETAH_SIGNATURE_FLAG_MAP_A << shift);
 #ifdef DENSITY_LITTLE_ENDIAN
@@ -89,45 +93,49 @@ DENSITY_FORCE_INLINE void density_cheetah_encode_kernel(uint8_t **DENSITY_RESTRI
 #endif
             *out += sizeof(uint16_t);
         }
-        *predictedChunk = *unit;    // Does not ensure dictionary content consistency between endiannesses
+        if (update)
+            *predictedChunk = *unit;    // Does not ensure dictionary content consistency between endiannesses
     }
     *last_hash = hash;
 }
 
-DENSITY_FORCE_INLINE void density_cheetah_encode_4(const uint8_t **DENSITY_RESTRICT in, uint8_t **DENSITY_RESTRICT out, uint_fast16_t *DENSITY_RESTRICT last_hash, const uint_fast8_t shift, density_cheetah_signature *const DENSITY_RESTRICT signature, density_cheetah_dictionary *const DENSITY_RESTRICT dictionary, uint32_t *DENSITY_RESTRICT unit) {
+DENSITY_FORCE_INLINE void density_cheetah_encode_4(const uint8_t **DENSITY_RESTRICT in, uint8_t **DENSITY_RESTRICT out, uint_fast16_t *DENSITY_RESTRICT last_hash, const uint_fast8_t shift, density_cheetah_signature *const DENSITY_RESTRICT signature, density_cheetah_dictionary *const DENSITY_RESTRICT dictionary, density_algorithm_epochs *const DENSITY_RESTRICT epochs, const bool update, uint32_t *DENSITY_RESTRICT unit, const uint_fast8_t hash_bits) {
     DENSITY_MEMCPY(unit, *in, sizeof(uint32_t));
     *in += sizeof(uint32_t);
-    density_cheetah_encode_kernel(out, last_hash, DENSITY_CHEETAH_HASH_ALGORITHM(DENSITY_LITTLE_ENDIAN_32(*unit)), shift, signature, dictionary, unit);
+    density_cheetah_encode_kernel(out, last_hash, DENSITY_CHEETAH_HASH_ALGORITHM(DENSITY_LITTLE_ENDIAN_32(*unit), hash_bits), shift, signature, dictionary, epochs, update, unit, hash_bits);
 }
 
-DENSITY_FORCE_INLINE void density_cheetah_encode_128(const uint8_t **DENSITY_RESTRICT in, uint8_t **DENSITY_RESTRICT out, uint_fast16_t *DENSITY_RESTRICT last_hash, density_cheetah_signature *const DENSITY_RESTRICT signature, density_cheetah_dictionary *const DENSITY_RESTRICT dictionary, uint32_t *DENSITY_RESTRICT unit) {
+DENSITY_FORCE_INLINE void density_cheetah_encode_128(const uint8_t **DENSITY_RESTRICT in, uint8_t **DENSITY_RESTRICT out, uint_fast16_t *DENSITY_RESTRICT last_hash, density_cheetah_signature *const DENSITY_RESTRICT signature, density_cheetah_dictionary *const DENSITY_RESTRICT dictionary, density_algorithm_epochs *const DENSITY_RESTRICT epochs, const bool update, uint32_t *DENSITY_RESTRICT unit, const uint_fast8_t hash_bits) {
     uint_fast8_t count = 0;
 
 #ifdef __clang__
     for(; count < density_bitsizeof(density_cheetah_signature); count += 2) {
-        density_cheetah_encode_4(in, out, last_hash, count, signature, dictionary, unit);
+        density_cheetah_encode_4(in, out, last_hash, count, signature, dictionary, epochs, update, unit, hash_bits);
     }
 #else
     for (uint_fast8_t count_b = 0; count_b < 16; count_b++) {
         DENSITY_UNROLL_2(\
-        density_cheetah_encode_4(in, out, last_hash, count, signature, dictionary, unit);\
+        density_cheetah_encode_4(in, out, last_hash, count, signature, dictionary, epochs, update, unit, hash_bits);\
         count += 2);
     }
 #endif
 }
 
-DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE density_algorithm_exit_status density_cheetah_encode(density_algorithm_state *const DENSITY_RESTRICT state, const uint8_t **DENSITY_RESTRICT in, const uint_fast64_t in_size, uint8_t **DENSITY_RESTRICT out, const uint_fast64_t out_size) {
+DENSITY_FORCE_INLINE density_algorithm_exit_status density_cheetah_encode_with_epochs(density_algorithm_state *const DENSITY_RESTRICT state, const uint8_t **DENSITY_RESTRICT in, const uint_fast64_t in_size, uint8_t **DENSITY_RESTRICT out, const uint_fast64_t out_size, density_algorithm_epochs *const DENSITY_RESTRICT epochs, const bool update, const uint_fast8_t hash_bits) {
     if (out_size < DENSITY_CHEETAH_MAXIMUM_COMPRESSED_UNIT_SIZE)
         return DENSITY_ALGORITHMS_EXIT_STATUS_OUTPUT_STALL;
 
     density_cheetah_signature signature;
     density_cheetah_signature *signature_pointer;
-    uint_fast16_t last_hash = 0;
+    uint_fast16_t last_hash = state->last_hash;
     uint32_t unit;
 
     uint8_t *out_limit = *out + out_size - DENSITY_CHEETAH_MAXIMUM_COMPRESSED_UNIT_SIZE;
     uint_fast64_t limit_128 = (in_size >> 7);
 
+    if (epochs)
+        density_cheetah_dictionary_touch((density_cheetah_dictionary *const) state->dictionary, epochs, last_hash, hash_bits);
+
     while (DENSITY_LIKELY(limit_128-- && *out <= out_limit)) {
         if (DENSITY_UNLIKELY(!(state->counter & 0x1f))) {
             DENSITY_ALGORITHM_REDUCE_COPY_PENALTY_START;
@@ -140,7 +148,7 @@ DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE density_algorithm_exit_status densit
             const uint8_t *out_start = *out;
             density_cheetah_encode_prepare_signature(out, &signature_pointer, &signature);
             DENSITY_PREFETCH(*in + DENSITY_CHEETAH_WORK_BLOCK_SIZE);
-            density_cheetah_encode_128(in, out, &last_hash, &signature, (density_cheetah_dictionary *const) state->dictionary, &unit);
+            density_cheetah_encode_128(in, out, &last_hash, &signature, (density_cheetah_dictionary *const) state->dictionary, epochs, update, &unit, hash_bits);
 #ifdef DENSITY_LITTLE_ENDIAN
             DENSITY_MEMCPY(signature_pointer, &signature, sizeof(density_cheetah_signature));
 #elif defined(DENSITY_BIG_ENDIAN)
@@ -181,7 +189,7 @@ DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE density_algorithm_exit_status densit
     const uint_fast64_t limit_4 = ((in_size & 0x7f) >> 2) << 1; // 4-byte units times number of signature flag bits
     density_cheetah_encode_prepare_signature(out, &signature_pointer, &signature);
     for (uint_fast8_t shift = 0; shift != limit_4; shift += 2)
-        density_cheetah_encode_4(in, out, &last_hash, shift, &signature, (density_cheetah_dictionary *const) state->dictionary, &unit);
+        density_cheetah_encode_4(in, out, &last_hash, shift, &signature, (density_cheetah_dictionary *const) state->dictionary, epochs, update, &unit, hash_bits);
 
     signature |= ((uint64_t) DENSITY_CHEETAH_SIGNATURE_FLAG_CHUNK << limit_4);  // End marker
 #ifdef DENSITY_LITTLE_ENDIAN
@@ -198,5 +206,16 @@ DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE density_algorithm_exit_status densit
     if (remaining)
     DENSITY_ALGORITHM_COPY(remaining);
 
+    state->last_hash = last_hash;
     return DENSITY_ALGORITHMS_EXIT_STATUS_FINISHED;
 }
+
+DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE density_algorithm_exit_status density_cheetah_encode(density_algorithm_state *const DENSITY_RESTRICT state, const uint8_t **DENSITY_RESTRICT in, const uint_fast64_t in_size, uint8_t **DENSITY_RESTRICT out, const uint_fast64_t out_size) {
+    if (DENSITY_ALGORITHMS_DEFAULT_CASE(state))
+        return density_cheetah_encode_with_epochs(state, in, in_size, out, out_size, NULL, true, DENSITY_HASH_BITS_DEFAULT);
+    if (!DENSITY_ALGORITHMS_VALID_HASH_BITS(state->hash_bits))
+        return DENSITY_ALGORITHMS_EXIT_STATUS_ERROR_DURING_PROCESSING;
+    return density_cheetah_encode_with_epochs(state, in, in_size, out, out_size, DENSITY_ALGORITHMS_EPOCHS(state), !state->static_dictionary, state->hash_bits);
+}
+
+DENSITY_ALGORITHMS_KERNEL_VARIANTS(density_cheetah_encode)
@@ -51,4 +51,6 @@
 
 DENSITY_WINDOWS_EXPORT density_algorithm_exit_status density_cheetah_encode(density_algorithm_state *const DENSITY_RESTRICT_DECLARE, const uint8_t **DENSITY_RESTRICT_DECLARE, const uint_fast64_t, uint8_t **DENSITY_RESTRICT_DECLARE, const uint_fast64_t);
 
+DENSITY_ALGORITHMS_KERNEL_VARIANTS_PROTOTYPES(density_cheetah_encode)
+
 #endif
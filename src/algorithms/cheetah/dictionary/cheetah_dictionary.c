@@ -0,0 +1,69 @@
+/*
+ * Centaurean Density
+ *
+ * Copyright (c) 2013, Guillaume Voirin
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     1. Redistributions of source code must retain the above copyright notice, this
+ *        list of conditions and the following disclaimer.
+ *
+ *     2. Redistributions in binary form must reproduce the above copyright notice,
+ *        this list of conditions and the following disclaimer in the documentation
+ *        and/or other materials provided with the distribution.
+ *
+ *     3. Neither the name of the copyright holder nor the names of its
+ *        contributors may be used to endorse or promote products derived from
+ *        this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * 17/10/26 04:46
+ *
+ * -----------------
+ * Cheetah algorithm
+ * -----------------
+ *
+ * Author(s)
+ * Guillaume Voirin (https://github.com/gpnuma)
+ * Piotr Tarsa (https://github.com/tarsa)
+ *
+ * Description
+ * Very fast two level dictionary hash algorithm derived from Chameleon, with predictions lookup
+ */
+
+#include "cheetah_dictionary.h"
+
+DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE size_t density_cheetah_dictionary_size(const uint_fast8_t hash_bits) {
+    return (sizeof(density_cheetah_dictionary_entry) + sizeof(density_cheetah_dictionary_prediction_entry)) << hash_bits;
+}
+
+DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE density_cheetah_dictionary_prediction_entry *density_cheetah_dictionary_predictions(density_cheetah_dictionary *const dictionary, const uint_fast8_t hash_bits) {
+    return (density_cheetah_dictionary_prediction_entry *) ((uint8_t *) dictionary + (sizeof(density_cheetah_dictionary_entry) << hash_bits));
+}
+
+DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE void density_cheetah_dictionary_touch(density_cheetah_dictionary *const DENSITY_RESTRICT dictionary, density_algorithm_epochs *const DENSITY_RESTRICT epochs, const uint_fast16_t hash, const uint_fast8_t hash_bits) {
+    const uint_fast16_t page = hash >> DENSITY_ALGORITHMS_EPOCHS_PAGE_BITS;
+    if (DENSITY_LIKELY(epochs->pages[page] == epochs->current))
+        return;
+    if (epochs->base) {
+        density_cheetah_dictionary *const base = (density_cheetah_dictionary *) epochs->base;
+        DENSITY_MEMCPY(&dictionary->entries[page << DENSITY_ALGORITHMS_EPOCHS_PAGE_BITS], &base->entries[page << DENSITY_ALGORITHMS_EPOCHS_PAGE_BITS], sizeof(density_cheetah_dictionary_entry) << DENSITY_ALGORITHMS_EPOCHS_PAGE_BITS);
+        DENSITY_MEMCPY(&density_cheetah_dictionary_predictions(dictionary, hash_bits)[page << DENSITY_ALGORITHMS_EPOCHS_PAGE_BITS], &density_cheetah_dictionary_predictions(base, hash_bits)[page << DENSITY_ALGORITHMS_EPOCHS_PAGE_BITS], sizeof(density_cheetah_dictionary_prediction_entry) << DENSITY_ALGORITHMS_EPOCHS_PAGE_BITS);
+    } else {
+        DENSITY_MEMSET(&dictionary->entries[page << DENSITY_ALGORITHMS_EPOCHS_PAGE_BITS], 0, sizeof(density_cheetah_dictionary_entry) << DENSITY_ALGORITHMS_EPOCHS_PAGE_BITS);
+        DENSITY_MEMSET(&density_cheetah_dictionary_predictions(dictionary, hash_bits)[page << DENSITY_ALGORITHMS_EPOCHS_PAGE_BITS], 0, sizeof(density_cheetah_dictionary_prediction_entry) << DENSITY_ALGORITHMS_EPOCHS_PAGE_BITS);
+    }
+    epochs->pages[page] = epochs->current;
+}
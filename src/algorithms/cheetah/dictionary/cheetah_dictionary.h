@@ -47,6 +47,7 @@
 #define DENSITY_CHEETAH_DICTIONARY_H
 
 #include "../cheetah.h"
+#include "../../algorithms.h"
 
 #include <string.h>
 
@@ -61,10 +62,20 @@ typedef struct {
     uint32_t next_chunk_prediction;
 } density_cheetah_dictionary_prediction_entry;
 
+/*
+ * Predictions are kept apart from chunks : on hosts whose L2 holds the 768 KB default dictionary, the dense prediction array stays hotter in L1 than interleaved entries would.
+ * Smaller L2 caches were not measured, and could favour co-located entries on large inputs.
+ * Only the first 1 << hash_bits entries are allocated, immediately followed by as many prediction entries
+ */
 typedef struct {
-    density_cheetah_dictionary_entry entries[1 << DENSITY_CHEETAH_HASH_BITS];
-    density_cheetah_dictionary_prediction_entry prediction_entries[1 << DENSITY_CHEETAH_HASH_BITS];
+    density_cheetah_dictionary_entry entries[1 << DENSITY_HASH_BITS_MAXIMUM];
 } density_cheetah_dictionary;
 #pragma pack(pop)
 
+DENSITY_WINDOWS_EXPORT size_t density_cheetah_dictionary_size(const uint_fast8_t);
+
+DENSITY_WINDOWS_EXPORT density_cheetah_dictionary_prediction_entry *density_cheetah_dictionary_predictions(density_cheetah_dictionary *const, const uint_fast8_t);
+
+DENSITY_WINDOWS_EXPORT void density_cheetah_dictionary_touch(density_cheetah_dictionary *const DENSITY_RESTRICT_DECLARE, density_algorithm_epochs *const DENSITY_RESTRICT_DECLARE, const uint_fast16_t, const uint_fast8_t);
+
 #endif
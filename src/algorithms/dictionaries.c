@@ -35,13 +35,19 @@
 #include "dictionaries.h"
 
 DENSITY_WINDOWS_EXPORT size_t density_get_dictionary_size(DENSITY_ALGORITHM algorithm) {
+    return density_get_dictionary_size_with_hash_bits(algorithm, DENSITY_HASH_BITS_DEFAULT);
+}
+
+DENSITY_WINDOWS_EXPORT size_t density_get_dictionary_size_with_hash_bits(DENSITY_ALGORITHM algorithm, const uint8_t hash_bits) {
+    if (hash_bits < DENSITY_HASH_BITS_MINIMUM || hash_bits > DENSITY_HASH_BITS_MAXIMUM)
+        return 0;
     switch(algorithm) {
         case DENSITY_ALGORITHM_CHAMELEON:
-            return sizeof(density_chameleon_dictionary);
+            return density_chameleon_dictionary_size(hash_bits);
         case DENSITY_ALGORITHM_CHEETAH:
-            return sizeof(density_cheetah_dictionary);
+            return density_cheetah_dictionary_size(hash_bits);
         case DENSITY_ALGORITHM_LION:
-            return sizeof(density_lion_dictionary);
+            return density_lion_dictionary_size(hash_bits);
         default:
             return 0;
     }
@@ -41,5 +41,6 @@
 #include "../algorithms/lion/dictionary/lion_dictionary.h"
 
 DENSITY_WINDOWS_EXPORT size_t density_get_dictionary_size(DENSITY_ALGORITHM);
+DENSITY_WINDOWS_EXPORT size_t density_get_dictionary_size_with_hash_bits(DENSITY_ALGORITHM, const uint8_t);
 
 #endif
@@ -57,17 +57,7 @@ DENSITY_FORCE_INLINE void density_lion_decode_read_signature(const uint8_t **DEN
     *in += sizeof(density_lion_signature);
 }
 
-DENSITY_FORCE_INLINE void density_lion_decode_update_predictions_model(density_lion_dictionary_chunk_prediction_entry *const DENSITY_RESTRICT predictions, const uint32_t chunk) {
-    DENSITY_MEMMOVE((uint32_t *) predictions + 1, predictions, 2 * sizeof(uint32_t));
-    *(uint32_t *) predictions = chunk;     // Move chunk to the top of the predictions list, does not ensure dictionary content consistency between endiannesses
-}
-
-DENSITY_FORCE_INLINE void density_lion_decode_update_dictionary_model(density_lion_dictionary_chunk_entry *const DENSITY_RESTRICT entry, const uint32_t chunk) {
-    DENSITY_MEMMOVE((uint32_t *) entry + 1, entry, 3 * sizeof(uint32_t));
-    *(uint32_t *) entry = chunk;    // Does not ensure dictionary content consistency between endiannesses
-}
-
-DENSITY_FORCE_INLINE void density_lion_decode_read_hash(const uint8_t **DENSITY_RESTRICT in, uint16_t *DENSITY_RESTRICT const hash) {
+DENSITY_FORCE_INLINE void density_lion_decode_read_hash(const uint8_t **DENSITY_RESTRICT in, uint16_t *DENSITY_RESTRICT const hash, const uint_fast8_t hash_bits) {
 #ifdef DENSITY_LITTLE_ENDIAN
     DENSITY_MEMCPY(hash, *in, sizeof(uint16_t));
 #elif defined(DENSITY_BIG_ENDIAN)
@@ -77,111 +67,155 @@ DENSITY_FORCE_INLINE void density_lion_decode_read_hash(const uint8_t **DENSITY_
 #else
 #error
 #endif
+    *hash &= (uint16_t) ((1 << hash_bits) - 1);     // Keeps corrupted input within the dictionary
     *in += sizeof(uint16_t);
 }
 
-DENSITY_FORCE_INLINE void density_lion_decode_prediction_generic(uint8_t **DENSITY_RESTRICT out, uint16_t *DENSITY_RESTRICT const hash, uint32_t *DENSITY_RESTRICT const unit) {
-    *hash = DENSITY_LION_HASH_ALGORITHM(DENSITY_LITTLE_ENDIAN_32(*unit));
+DENSITY_FORCE_INLINE void density_lion_decode_prediction_generic(uint8_t **DENSITY_RESTRICT out, density_lion_dictionary *const DENSITY_RESTRICT dictionary, density_algorithm_epochs *const DENSITY_RESTRICT epochs, uint16_t *DENSITY_RESTRICT const hash, uint32_t *DENSITY_RESTRICT const unit, const uint_fast8_t hash_bits) {
+    *hash = DENSITY_LION_HASH_ALGORITHM(DENSITY_LITTLE_ENDIAN_32(*unit), hash_bits);
+    if (epochs)
+        density_lion_dictionary_touch(dictionary, epochs, *hash);
     DENSITY_MEMCPY(*out, unit, sizeof(uint32_t));
     *out += sizeof(uint32_t);
 }
 
-DENSITY_FORCE_INLINE void density_lion_decode_dictionary_generic(uint8_t **DENSITY_RESTRICT out, uint_fast16_t *DENSITY_RESTRICT last_hash, density_lion_dictionary *const DENSITY_RESTRICT dictionary, uint32_t *DENSITY_RESTRICT const unit) {
+DENSITY_FORCE_INLINE void density_lion_decode_dictionary_generic(uint8_t **DENSITY_RESTRICT out, uint_fast16_t *DENSITY_RESTRICT last_hash, density_lion_dictionary *const DENSITY_RESTRICT dictionary, const bool update, uint32_t *DENSITY_RESTRICT const unit) {
     DENSITY_MEMCPY(*out, unit, sizeof(uint32_t));
     *out += sizeof(uint32_t);
-    density_lion_dictionary_chunk_prediction_entry *prediction = &(dictionary->predictions[*last_hash]);
-    density_lion_decode_update_predictions_model(prediction, *unit);
+    if (update)
+        density_lion_dictionary_push_prediction(&dictionary->entries[*last_hash], *unit);
 }
 
-void density_lion_decode_prediction_a(const uint8_t **DENSITY_RESTRICT in, uint8_t **DENSITY_RESTRICT out, uint_fast16_t *DENSITY_RESTRICT last_hash, density_lion_dictionary *const DENSITY_RESTRICT dictionary, uint16_t *DENSITY_RESTRICT const hash, uint32_t *DENSITY_RESTRICT const unit) {
+DENSITY_FORCE_INLINE void density_lion_decode_prediction_a(const uint8_t **DENSITY_RESTRICT in, uint8_t **DENSITY_RESTRICT out, uint_fast16_t *DENSITY_RESTRICT last_hash, density_lion_dictionary *const DENSITY_RESTRICT dictionary, density_algorithm_epochs *const DENSITY_RESTRICT epochs, const bool update, uint16_t *DENSITY_RESTRICT const hash, uint32_t *DENSITY_RESTRICT const unit, const uint_fast8_t hash_bits) {
     (void)in;
-    *unit = dictionary->predictions[*last_hash].next_chunk_a;
-    density_lion_decode_prediction_generic(out, hash, unit);
+    (void)update;
+    *unit = density_lion_dictionary_prediction(&dictionary->entries[*last_hash], 0);
+    density_lion_decode_prediction_generic(out, dictionary, epochs, hash, unit, hash_bits);
 
     *last_hash = *hash;
 }
 
-void density_lion_decode_prediction_b(const uint8_t **DENSITY_RESTRICT in, uint8_t **DENSITY_RESTRICT out, uint_fast16_t *DENSITY_RESTRICT last_hash, density_lion_dictionary *const DENSITY_RESTRICT dictionary, uint16_t *DENSITY_RESTRICT const hash, uint32_t *DENSITY_RESTRICT const unit) {
+DENSITY_FORCE_INLINE void density_lion_decode_prediction_b(const uint8_t **DENSITY_RESTRICT in, uint8_t **DENSITY_RESTRICT out, uint_fast16_t *DENSITY_RESTRICT last_hash, density_lion_dictionary *const DENSITY_RESTRICT dictionary, density_algorithm_epochs *const DENSITY_RESTRICT epochs, const bool update, uint16_t *DENSITY_RESTRICT const hash, uint32_t *DENSITY_RESTRICT const unit, const uint_fast8_t hash_bits) {
     (void)in;
-    density_lion_dictionary_chunk_prediction_entry *const prediction = &dictionary->predictions[*last_hash];
-    *unit = prediction->next_chunk_b;
-    density_lion_decode_update_predictions_model(prediction, *unit);
-    density_lion_decode_prediction_generic(out, hash, unit);
+    density_lion_dictionary_entry *const prediction = &dictionary->entries[*last_hash];
+    *unit = density_lion_dictionary_prediction(prediction, 1);
+    if (update)
+        density_lion_dictionary_push_prediction(prediction, *unit);
+    density_lion_decode_prediction_generic(out, dictionary, epochs, hash, unit, hash_bits);
 
     *last_hash = *hash;
 }
 
-void density_lion_decode_prediction_c(const uint8_t **DENSITY_RESTRICT in, uint8_t **DENSITY_RESTRICT out, uint_fast16_t *DENSITY_RESTRICT last_hash, density_lion_dictionary *const DENSITY_RESTRICT dictionary, uint16_t *DENSITY_RESTRICT const hash, uint32_t *DENSITY_RESTRICT const unit) {
+DENSITY_FORCE_INLINE void density_lion_decode_prediction_c(const uint8_t **DENSITY_RESTRICT in, uint8_t **DENSITY_RESTRICT out, uint_fast16_t *DENSITY_RESTRICT last_hash, density_lion_dictionary *const DENSITY_RESTRICT dictionary, density_algorithm_epochs *const DENSITY_RESTRICT epochs, const bool update, uint16_t *DENSITY_RESTRICT const hash, uint32_t *DENSITY_RESTRICT const unit, const uint_fast8_t hash_bits) {
     (void)in;
-    density_lion_dictionary_chunk_prediction_entry *const prediction = &dictionary->predictions[*last_hash];
-    *unit = prediction->next_chunk_c;
-    density_lion_decode_update_predictions_model(prediction, *unit);
-    density_lion_decode_prediction_generic(out, hash, unit);
+    density_lion_dictionary_entry *const prediction = &dictionary->entries[*last_hash];
+    *unit = density_lion_dictionary_prediction(prediction, 2);
+    if (update)
+        density_lion_dictionary_push_prediction(prediction, *unit);
+    density_lion_decode_prediction_generic(out, dictionary, epochs, hash, unit, hash_bits);
 
     *last_hash = *hash;
 }
 
-void density_lion_decode_dictionary_a(const uint8_t **DENSITY_RESTRICT in, uint8_t **DENSITY_RESTRICT out, uint_fast16_t *DENSITY_RESTRICT last_hash, density_lion_dictionary *const DENSITY_RESTRICT dictionary, uint16_t *DENSITY_RESTRICT const hash, uint32_t *DENSITY_RESTRICT const unit) {
-    density_lion_decode_read_hash(in, hash);
-    DENSITY_PREFETCH(&dictionary->predictions[*hash]);
-    *unit = dictionary->chunks[*hash].chunk_a;
-    density_lion_decode_dictionary_generic(out, last_hash, dictionary, unit);
+DENSITY_FORCE_INLINE void density_lion_decode_dictionary_a(const uint8_t **DENSITY_RESTRICT in, uint8_t **DENSITY_RESTRICT out, uint_fast16_t *DENSITY_RESTRICT last_hash, density_lion_dictionary *const DENSITY_RESTRICT dictionary, density_algorithm_epochs *const DENSITY_RESTRICT epochs, const bool update, uint16_t *DENSITY_RESTRICT const hash, uint32_t *DENSITY_RESTRICT const unit, const uint_fast8_t hash_bits) {
+    density_lion_decode_read_hash(in, hash, hash_bits);
+    DENSITY_PREFETCH(&dictionary->entries[*hash]);
+    if (epochs)
+        density_lion_dictionary_touch(dictionary, epochs, *hash);
+    *unit = density_lion_dictionary_chunk(&dictionary->entries[*hash], 0);
+    density_lion_decode_dictionary_generic(out, last_hash, dictionary, update, unit);
 
     *last_hash = *hash;
 }
 
-void density_lion_decode_dictionary_b(const uint8_t **DENSITY_RESTRICT in, uint8_t **DENSITY_RESTRICT out, uint_fast16_t *DENSITY_RESTRICT last_hash, density_lion_dictionary *const DENSITY_RESTRICT dictionary, uint16_t *DENSITY_RESTRICT const hash, uint32_t *DENSITY_RESTRICT const unit) {
-    density_lion_decode_read_hash(in, hash);
-  	DENSITY_PREFETCH(&dictionary->predictions[*hash]);
-    density_lion_dictionary_chunk_entry *entry = &dictionary->chunks[*hash];
-    *unit = entry->chunk_b;
-    density_lion_decode_update_dictionary_model(entry, *unit);
-    density_lion_decode_dictionary_generic(out, last_hash, dictionary, unit);
+DENSITY_FORCE_INLINE void density_lion_decode_dictionary_b(const uint8_t **DENSITY_RESTRICT in, uint8_t **DENSITY_RESTRICT out, uint_fast16_t *DENSITY_RESTRICT last_hash, density_lion_dictionary *const DENSITY_RESTRICT dictionary, density_algorithm_epochs *const DENSITY_RESTRICT epochs, const bool update, uint16_t *DENSITY_RESTRICT const hash, uint32_t *DENSITY_RESTRICT const unit, const uint_fast8_t hash_bits) {
+    density_lion_decode_read_hash(in, hash, hash_bits);
+  	DENSITY_PREFETCH(&dictionary->entries[*hash]);
+    if (epochs)
+        density_lion_dictionary_touch(dictionary, epochs, *hash);
+    density_lion_dictionary_entry *const entry = &dictionary->entries[*hash];
+    *unit = density_lion_dictionary_chunk(entry, 1);
+    if (update)
+        density_lion_dictionary_push_chunk(entry, *unit);
+    density_lion_decode_dictionary_generic(out, last_hash, dictionary, update, unit);
 
     *last_hash = *hash;
 }
 
-void density_lion_decode_dictionary_c(const uint8_t **DENSITY_RESTRICT in, uint8_t **DENSITY_RESTRICT out, uint_fast16_t *DENSITY_RESTRICT last_hash, density_lion_dictionary *const DENSITY_RESTRICT dictionary, uint16_t *DENSITY_RESTRICT const hash, uint32_t *DENSITY_RESTRICT const unit) {
-    density_lion_decode_read_hash(in, hash);
-  	DENSITY_PREFETCH(&dictionary->predictions[*hash]);
-    density_lion_dictionary_chunk_entry *entry = &dictionary->chunks[*hash];
-    *unit = entry->chunk_c;
-    density_lion_decode_update_dictionary_model(entry, *unit);
-    density_lion_decode_dictionary_generic(out, last_hash, dictionary, unit);
+DENSITY_FORCE_INLINE void density_lion_decode_dictionary_c(const uint8_t **DENSITY_RESTRICT in, uint8_t **DENSITY_RESTRICT out, uint_fast16_t *DENSITY_RESTRICT last_hash, density_lion_dictionary *const DENSITY_RESTRICT dictionary, density_algorithm_epochs *const DENSITY_RESTRICT epochs, const bool update, uint16_t *DENSITY_RESTRICT const hash, uint32_t *DENSITY_RESTRICT const unit, const uint_fast8_t hash_bits) {
+    density_lion_decode_read_hash(in, hash, hash_bits);
+  	DENSITY_PREFETCH(&dictionary->entries[*hash]);
+    if (epochs)
+        density_lion_dictionary_touch(dictionary, epochs, *hash);
+    density_lion_dictionary_entry *const entry = &dictionary->entries[*hash];
+    *unit = density_lion_dictionary_chunk(entry, 2);
+    if (update)
+        density_lion_dictionary_push_chunk(entry, *unit);
+    density_lion_decode_dictionary_generic(out, last_hash, dictionary, update, unit);
 
     *last_hash = *hash;
 }
 
-void density_lion_decode_dictionary_d(const uint8_t **DENSITY_RESTRICT in, uint8_t **DENSITY_RESTRICT out, uint_fast16_t *DENSITY_RESTRICT last_hash, density_lion_dictionary *const DENSITY_RESTRICT dictionary, uint16_t *DENSITY_RESTRICT const hash, uint32_t *DENSITY_RESTRICT const unit) {
-    density_lion_decode_read_hash(in, hash);
-  	DENSITY_PREFETCH(&dictionary->predictions[*hash]);
-    density_lion_dictionary_chunk_entry *entry = &dictionary->chunks[*hash];
-    *unit = entry->chunk_d;
-    density_lion_decode_update_dictionary_model(entry, *unit);
-    density_lion_decode_dictionary_generic(out, last_hash, dictionary, unit);
+DENSITY_FORCE_INLINE void density_lion_decode_dictionary_d(const uint8_t **DENSITY_RESTRICT in, uint8_t **DENSITY_RESTRICT out, uint_fast16_t *DENSITY_RESTRICT last_hash, density_lion_dictionary *const DENSITY_RESTRICT dictionary, density_algorithm_epochs *const DENSITY_RESTRICT epochs, const bool update, uint16_t *DENSITY_RESTRICT const hash, uint32_t *DENSITY_RESTRICT const unit, const uint_fast8_t hash_bits) {
+    density_lion_decode_read_hash(in, hash, hash_bits);
+  	DENSITY_PREFETCH(&dictionary->entries[*hash]);
+    if (epochs)
+        density_lion_dictionary_touch(dictionary, epochs, *hash);
+    density_lion_dictionary_entry *const entry = &dictionary->entries[*hash];
+    *unit = density_lion_dictionary_chunk(entry, 3);
+    if (update)
+        density_lion_dictionary_push_chunk(entry, *unit);
+    density_lion_decode_dictionary_generic(out, last_hash, dictionary, update, unit);
 
     *last_hash = *hash;
 }
 
-void density_lion_decode_plain(const uint8_t **DENSITY_RESTRICT in, uint8_t **DENSITY_RESTRICT out, uint_fast16_t *DENSITY_RESTRICT last_hash, density_lion_dictionary *const DENSITY_RESTRICT dictionary, uint16_t *DENSITY_RESTRICT const hash, uint32_t *DENSITY_RESTRICT const unit) {
+DENSITY_FORCE_INLINE void density_lion_decode_plain(const uint8_t **DENSITY_RESTRICT in, uint8_t **DENSITY_RESTRICT out, uint_fast16_t *DENSITY_RESTRICT last_hash, density_lion_dictionary *const DENSITY_RESTRICT dictionary, density_algorithm_epochs *const DENSITY_RESTRICT epochs, const bool update, uint16_t *DENSITY_RESTRICT const hash, uint32_t *DENSITY_RESTRICT const unit, const uint_fast8_t hash_bits) {
     DENSITY_MEMCPY(unit, *in, sizeof(uint32_t));
     *in += sizeof(uint32_t);
-    *hash = DENSITY_LION_HASH_ALGORITHM(DENSITY_LITTLE_ENDIAN_32(*unit));
-    density_lion_dictionary_chunk_entry *entry = &dictionary->chunks[*hash];
-    density_lion_decode_update_dictionary_model(entry, *unit);
+    *hash = DENSITY_LION_HASH_ALGORITHM(DENSITY_LITTLE_ENDIAN_32(*unit), hash_bits);
+    if (epochs)
+        density_lion_dictionary_touch(dictionary, epochs, *hash);
+    if (update)
+        density_lion_dictionary_push_chunk(&dictionary->entries[*hash], *unit);
     DENSITY_MEMCPY(*out, unit, sizeof(uint32_t));
     *out += sizeof(uint32_t);
-    density_lion_dictionary_chunk_prediction_entry *prediction = &(dictionary->predictions[*last_hash]);
-    density_lion_decode_update_predictions_model(prediction, *unit);
+    if (update)
+        density_lion_dictionary_push_prediction(&dictionary->entries[*last_hash], *unit);
 
     *last_hash = *hash;
 }
 
-DENSITY_FORCE_INLINE void density_lion_decode_4(const uint8_t **DENSITY_RESTRICT in, uint8_t **DENSITY_RESTRICT out, uint_fast16_t *DENSITY_RESTRICT last_hash, density_lion_dictionary *const DENSITY_RESTRICT dictionary, density_lion_form_data *const data, const DENSITY_LION_FORM form) {
+DENSITY_FORCE_INLINE void density_lion_decode_4(const uint8_t **DENSITY_RESTRICT in, uint8_t **DENSITY_RESTRICT out, uint_fast16_t *DENSITY_RESTRICT last_hash, density_lion_dictionary *const DENSITY_RESTRICT dictionary, density_algorithm_epochs *const DENSITY_RESTRICT epochs, const bool update, const DENSITY_LION_FORM form, const uint_fast8_t hash_bits) {
     uint16_t hash;
     uint32_t unit;
 
-    data->attachments[form](in, out, last_hash, dictionary, &hash, &unit);
+    switch (form) {
+        case DENSITY_LION_FORM_PREDICTIONS_A:
+            density_lion_decode_prediction_a(in, out, last_hash, dictionary, epochs, update, &hash, &unit, hash_bits);
+            break;
+        case DENSITY_LION_FORM_PREDICTIONS_B:
+            density_lion_decode_prediction_b(in, out, last_hash, dictionary, epochs, update, &hash, &unit, hash_bits);
+            break;
+        case DENSITY_LION_FORM_PREDICTIONS_C:
+            density_lion_decode_prediction_c(in, out, last_hash, dictionary, epochs, update, &hash, &unit, hash_bits);
+            break;
+        case DENSITY_LION_FORM_DICTIONARY_A:
+            density_lion_decode_dictionary_a(in, out, last_hash, dictionary, epochs, update, &hash, &unit, hash_bits);
+            break;
+        case DENSITY_LION_FORM_DICTIONARY_B:
+            density_lion_decode_dictionary_b(in, out, last_hash, dictionary, epochs, update, &hash, &unit, hash_bits);
+            break;
+        case DENSITY_LION_FORM_DICTIONARY_C:
+            density_lion_decode_dictionary_c(in, out, last_hash, dictionary, epochs, update, &hash, &unit, hash_bits);
+            break;
+        case DENSITY_LION_FORM_DICTIONARY_D:
+            density_lion_decode_dictionary_d(in, out, last_hash, dictionary, epochs, update, &hash, &unit, hash_bits);
+            break;
+        default:
+            density_lion_decode_plain(in, out, last_hash, dictionary, epochs, update, &hash, &unit, hash_bits);
+            break;
+    }
 }
 
 DENSITY_FORCE_INLINE DENSITY_LION_FORM density_lion_decode_read_form(const uint8_t **DENSITY_RESTRICT in, uint_fast64_t *const DENSITY_RESTRICT signature, uint_fast8_t *const DENSITY_RESTRICT shift, density_lion_form_data *const form_data) {
@@ -210,49 +244,53 @@ DENSITY_FORCE_INLINE DENSITY_LION_FORM density_lion_decode_read_form(const uint8
     }
 }
 
-DENSITY_FORCE_INLINE void density_lion_decode_process_form(const uint8_t **DENSITY_RESTRICT in, uint8_t **DENSITY_RESTRICT out, uint_fast16_t *DENSITY_RESTRICT last_hash, density_lion_dictionary *const DENSITY_RESTRICT dictionary, density_lion_form_data *const form_data, uint_fast64_t *const DENSITY_RESTRICT signature, uint_fast8_t *const DENSITY_RESTRICT shift) {
+DENSITY_FORCE_INLINE void density_lion_decode_process_form(const uint8_t **DENSITY_RESTRICT in, uint8_t **DENSITY_RESTRICT out, uint_fast16_t *DENSITY_RESTRICT last_hash, density_lion_dictionary *const DENSITY_RESTRICT dictionary, density_algorithm_epochs *const DENSITY_RESTRICT epochs, const bool update, density_lion_form_data *const form_data, uint_fast64_t *const DENSITY_RESTRICT signature, uint_fast8_t *const DENSITY_RESTRICT shift, const uint_fast8_t hash_bits) {
     if (DENSITY_UNLIKELY(!*shift))
         density_lion_decode_read_signature(in, signature);
 
     switch ((*signature >> *shift) & 0x1) {
         case 0:
-            density_lion_decode_4(in, out, last_hash, dictionary, form_data, density_lion_decode_read_form(in, signature, shift, form_data));
+            density_lion_decode_4(in, out, last_hash, dictionary, epochs, update, density_lion_decode_read_form(in, signature, shift, form_data), hash_bits);
             break;
         default:
-            density_lion_decode_4(in, out, last_hash, dictionary, form_data, density_lion_form_model_increment_usage(form_data, (density_lion_form_node *) form_data->formsPool));
+            density_lion_decode_4(in, out, last_hash, dictionary, epochs, update, density_lion_form_model_increment_usage(form_data, (density_lion_form_node *) form_data->formsPool), hash_bits);
             *shift = (uint_fast8_t)((*shift + 1) & 0x3f);
             break;
     }
 }
 
-DENSITY_FORCE_INLINE void density_lion_decode_256(const uint8_t **DENSITY_RESTRICT in, uint8_t **DENSITY_RESTRICT out, uint_fast16_t *DENSITY_RESTRICT last_hash, density_lion_dictionary *const DENSITY_RESTRICT dictionary, density_lion_form_data *const form_data, uint_fast64_t *const DENSITY_RESTRICT signature, uint_fast8_t *const DENSITY_RESTRICT shift) {
+DENSITY_FORCE_INLINE void density_lion_decode_256(const uint8_t **DENSITY_RESTRICT in, uint8_t **DENSITY_RESTRICT out, uint_fast16_t *DENSITY_RESTRICT last_hash, density_lion_dictionary *const DENSITY_RESTRICT dictionary, density_algorithm_epochs *const DENSITY_RESTRICT epochs, const bool update, density_lion_form_data *const form_data, uint_fast64_t *const DENSITY_RESTRICT signature, uint_fast8_t *const DENSITY_RESTRICT shift, const uint_fast8_t hash_bits) {
 #ifdef __clang__
     for (uint_fast8_t count = 0; count < (DENSITY_LION_CHUNKS_PER_PROCESS_UNIT_BIG >> 2); count++) {
-        DENSITY_UNROLL_4(density_lion_decode_process_form(in, out, last_hash, dictionary, form_data, signature, shift));
+        DENSITY_UNROLL_4(density_lion_decode_process_form(in, out, last_hash, dictionary, epochs, update, form_data, signature, shift, hash_bits));
     }
 #else
     for (uint_fast8_t count = 0; count < (DENSITY_LION_CHUNKS_PER_PROCESS_UNIT_BIG >> 2); count++) {
-        DENSITY_UNROLL_4(density_lion_decode_process_form(in, out, last_hash, dictionary, form_data, signature, shift));
+        DENSITY_UNROLL_4(density_lion_decode_process_form(in, out, last_hash, dictionary, epochs, update, form_data, signature, shift, hash_bits));
     }
 #endif
 }
 
-DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE density_algorithm_exit_status density_lion_decode(density_algorithm_state *const DENSITY_RESTRICT state, const uint8_t **DENSITY_RESTRICT in, const uint_fast64_t in_size, uint8_t **DENSITY_RESTRICT out, const uint_fast64_t out_size) {
+DENSITY_FORCE_INLINE density_algorithm_exit_status density_lion_decode_with_epochs(density_algorithm_state *const DENSITY_RESTRICT state, const uint8_t **DENSITY_RESTRICT in, const uint_fast64_t in_size, uint8_t **DENSITY_RESTRICT out, const uint_fast64_t out_size, density_algorithm_epochs *const DENSITY_RESTRICT epochs, const bool update, const uint_fast8_t hash_bits) {
     if (out_size < DENSITY_LION_MAXIMUM_DECOMPRESSED_UNIT_SIZE)
         return DENSITY_ALGORITHMS_EXIT_STATUS_OUTPUT_STALL;
 
     density_lion_signature signature = 0;
     density_lion_form_data data;
-    density_lion_form_model_init(&data);
-    void (*attachments[DENSITY_LION_NUMBER_OF_FORMS])(const uint8_t **, uint8_t **, uint_fast16_t *, void *const, uint16_t *const, uint32_t *const) = {(void (*)(const uint8_t **, uint8_t **, uint_fast16_t *, void *const, uint16_t *const, uint32_t *const)) &density_lion_decode_prediction_a, (void (*)(const uint8_t **, uint8_t **, uint_fast16_t *, void *const, uint16_t *const, uint32_t *const)) &density_lion_decode_prediction_b, (void (*)(const uint8_t **, uint8_t **, uint_fast16_t *, void *const, uint16_t *const, uint32_t *const)) &density_lion_decode_prediction_c, (void (*)(const uint8_t **, uint8_t **, uint_fast16_t *, void *const, uint16_t *const, uint32_t *const)) &density_lion_decode_dictionary_a, (void (*)(const uint8_t **, uint8_t **, uint_fast16_t *, void *const, uint16_t *const, uint32_t *const)) &density_lion_decode_dictionary_b, (void (*)(const uint8_t **, uint8_t **, uint_fast16_t *, void *const, uint16_t *const, uint32_t *const)) &density_lion_decode_dictionary_c, (void (*)(const uint8_t **, uint8_t **, uint_fast16_t *, void *const, uint16_t *const, uint32_t *const)) &density_lion_decode_dictionary_d, (void (*)(const uint8_t **, uint8_t **, uint_fast16_t *, void *const, uint16_t *const, uint32_t *const)) &density_lion_decode_plain};
-    density_lion_form_model_attach(&data, attachments);
+    if (state->model)
+        density_lion_form_model_copy(&data, (density_lion_form_data *) state->model);
+    else
+        density_lion_form_model_init(&data);
     uint_fast8_t shift = 0;
     uint_fast64_t remaining;
-    uint_fast16_t last_hash = 0;
+    uint_fast16_t last_hash = state->last_hash;
     DENSITY_LION_FORM form;
 
     const uint8_t *start = *in;
 
+    if (epochs)
+        density_lion_dictionary_touch((density_lion_dictionary *const) state->dictionary, epochs, last_hash);
+
     if (in_size < DENSITY_LION_MAXIMUM_COMPRESSED_UNIT_SIZE) {
         goto read_and_decode_4;
     }
@@ -270,7 +308,7 @@ DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE density_algorithm_exit_status densit
             DENSITY_ALGORITHM_INCREASE_COPY_PENALTY_START;
         } else {
             const uint8_t *in_start = *in;
-            density_lion_decode_256(in, out, &last_hash, (density_lion_dictionary *const) state->dictionary, &data, &signature, &shift);
+            density_lion_decode_256(in, out, &last_hash, (density_lion_dictionary *const) state->dictionary, epochs, update, &data, &signature, &shift, hash_bits);
             DENSITY_ALGORITHM_TEST_INCOMPRESSIBILITY((*in - in_start), DENSITY_LION_WORK_BLOCK_SIZE);
         }
     }
@@ -295,7 +333,7 @@ DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE density_algorithm_exit_status densit
                 case DENSITY_LION_FORM_PREDICTIONS_A:
                 case DENSITY_LION_FORM_PREDICTIONS_B:
                 case DENSITY_LION_FORM_PREDICTIONS_C:
-                    density_lion_decode_4(in, out, &last_hash, (density_lion_dictionary *const) state->dictionary, &data, form);
+                    density_lion_decode_4(in, out, &last_hash, (density_lion_dictionary *const) state->dictionary, epochs, update, form, hash_bits);
                     break;
                 default:
                     return DENSITY_ALGORITHMS_EXIT_STATUS_ERROR_DURING_PROCESSING;   // Not enough bytes to read a hash
@@ -307,12 +345,12 @@ DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE density_algorithm_exit_status densit
                 case DENSITY_LION_FORM_PLAIN:
                     goto process_remaining_bytes;   // End marker
                 default:
-                    density_lion_decode_4(in, out, &last_hash, (density_lion_dictionary *const) state->dictionary, &data, form);
+                    density_lion_decode_4(in, out, &last_hash, (density_lion_dictionary *const) state->dictionary, epochs, update, form, hash_bits);
                     break;
             }
             break;
         default:
-            density_lion_decode_4(in, out, &last_hash, (density_lion_dictionary *const) state->dictionary, &data, form);
+            density_lion_decode_4(in, out, &last_hash, (density_lion_dictionary *const) state->dictionary, epochs, update, form, hash_bits);
             break;
     }
     goto read_and_decode_4;
@@ -323,5 +361,132 @@ DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE density_algorithm_exit_status densit
     *in += remaining;
     *out += remaining;
 
+    if (state->model)
+        density_lion_form_model_copy((density_lion_form_data *) state->model, &data);
+    state->last_hash = last_hash;
+    return DENSITY_ALGORITHMS_EXIT_STATUS_FINISHED;
+}
+
+DENSITY_FORCE_INLINE bool density_lion_decode_read_form_bounded(const uint8_t **DENSITY_RESTRICT in, const uint8_t *const DENSITY_RESTRICT in_end, uint_fast64_t *const DENSITY_RESTRICT signature, uint_fast8_t *const DENSITY_RESTRICT shift, density_lion_form_data *const form_data, DENSITY_LION_FORM *const DENSITY_RESTRICT form) {
+    if (DENSITY_UNLIKELY(!*shift)) {
+        if (in_end - *in < (ptrdiff_t) sizeof(density_lion_signature))
+            return false;
+        density_lion_decode_read_signature(in, signature);
+    }
+    if (*shift > (density_bitsizeof(density_lion_signature) - 7) && DENSITY_CTZ(0x80 | (*signature >> *shift)) > 6 && in_end - *in < (ptrdiff_t) sizeof(density_lion_signature))
+        return false;   // The form code continues in a signature which is not there
+    *form = density_lion_decode_read_form(in, signature, shift, form_data);
+    return true;
+}
+
+DENSITY_FORCE_INLINE bool density_lion_decode_4_bounded(const uint8_t **DENSITY_RESTRICT in, const uint8_t *const DENSITY_RESTRICT in_end, uint8_t **DENSITY_RESTRICT out, uint_fast16_t *DENSITY_RESTRICT last_hash, density_lion_dictionary *const DENSITY_RESTRICT dictionary, density_algorithm_epochs *const DENSITY_RESTRICT epochs, const bool update, density_lion_form_data *const form_data, uint_fast64_t *const DENSITY_RESTRICT signature, uint_fast8_t *const DENSITY_RESTRICT shift, const uint_fast8_t hash_bits) {
+    DENSITY_LION_FORM form;
+    if (!density_lion_decode_read_form_bounded(in, in_end, signature, shift, form_data, &form))
+        return false;
+    switch (form) {
+        case DENSITY_LION_FORM_PREDICTIONS_A:
+        case DENSITY_LION_FORM_PREDICTIONS_B:
+        case DENSITY_LION_FORM_PREDICTIONS_C:
+            break;
+        case DENSITY_LION_FORM_PLAIN:
+            if (in_end - *in < (ptrdiff_t) sizeof(uint32_t))
+                return false;
+            break;
+        default:
+            if (in_end - *in < (ptrdiff_t) sizeof(uint16_t))
+                return false;
+            break;
+    }
+    density_lion_decode_4(in, out, last_hash, dictionary, epochs, update, form, hash_bits);
+    return true;
+}
+
+/*
+ * When the decompressed size is known, work blocks and units are counted the way the encoder produced them,
+ * instead of being guessed from the remaining input. This keeps raw work blocks near the end of input apart from encoded ones.
+ */
+DENSITY_FORCE_INLINE density_algorithm_exit_status density_lion_decode_exact_with_epochs(density_algorithm_state *const DENSITY_RESTRICT state, const uint8_t **DENSITY_RESTRICT in, const uint_fast64_t in_size, uint8_t **DENSITY_RESTRICT out, const uint_fast64_t out_size, density_algorithm_epochs *const DENSITY_RESTRICT epochs, const bool update, const uint_fast8_t hash_bits) {
+    const uint_fast64_t decompressed_size = state->decompressed_size;
+    if (out_size < decompressed_size)
+        return DENSITY_ALGORITHMS_EXIT_STATUS_OUTPUT_STALL;
+
+    density_lion_signature signature = 0;
+    density_lion_form_data data;
+    if (state->model)
+        density_lion_form_model_copy(&data, (density_lion_form_data *) state->model);
+    else
+        density_lion_form_model_init(&data);
+    uint_fast8_t shift = 0;
+    uint_fast16_t last_hash = state->last_hash;
+    DENSITY_LION_FORM form;
+
+    const uint8_t *const in_end = *in + in_size;
+
+    if (epochs)
+        density_lion_dictionary_touch((density_lion_dictionary *const) state->dictionary, epochs, last_hash);
+
+    uint_fast64_t limit_256 = decompressed_size >> 8;
+    while (limit_256--) {
+        if (DENSITY_UNLIKELY(!(state->counter & 0xf))) {
+            DENSITY_ALGORITHM_REDUCE_COPY_PENALTY_START;
+        }
+        state->counter++;
+        if (DENSITY_UNLIKELY(state->copy_penalty)) {
+            if (in_end - *in < DENSITY_LION_WORK_BLOCK_SIZE)
+                return DENSITY_ALGORITHMS_EXIT_STATUS_ERROR_DURING_PROCESSING;
+            DENSITY_ALGORITHM_COPY(DENSITY_LION_WORK_BLOCK_SIZE);
+            DENSITY_ALGORITHM_INCREASE_COPY_PENALTY_START;
+        } else {
+            const uint8_t *in_start = *in;
+            if (DENSITY_LIKELY(in_end - *in >= (ptrdiff_t) DENSITY_LION_MAXIMUM_COMPRESSED_UNIT_SIZE))
+                density_lion_decode_256(in, out, &last_hash, (density_lion_dictionary *const) state->dictionary, epochs, update, &data, &signature, &shift, hash_bits);
+            else {
+                for (uint_fast8_t count = 0; count < DENSITY_LION_CHUNKS_PER_PROCESS_UNIT_BIG; count++) {
+                    if (!density_lion_decode_4_bounded(in, in_end, out, &last_hash, (density_lion_dictionary *const) state->dictionary, epochs, update, &data, &signature, &shift, hash_bits))
+                        return DENSITY_ALGORITHMS_EXIT_STATUS_ERROR_DURING_PROCESSING;
+                }
+            }
+            DENSITY_ALGORITHM_TEST_INCOMPRESSIBILITY((*in - in_start), DENSITY_LION_WORK_BLOCK_SIZE);
+        }
+    }
+
+    uint_fast64_t limit_4 = (decompressed_size & 0xff) >> 2;
+    while (limit_4--) {
+        if (!density_lion_decode_4_bounded(in, in_end, out, &last_hash, (density_lion_dictionary *const) state->dictionary, epochs, update, &data, &signature, &shift, hash_bits))
+            return DENSITY_ALGORITHMS_EXIT_STATUS_ERROR_DURING_PROCESSING;
+    }
+
+    if (!density_lion_decode_read_form_bounded(in, in_end, &signature, &shift, &data, &form) || form != DENSITY_LION_FORM_PLAIN)
+        return DENSITY_ALGORITHMS_EXIT_STATUS_ERROR_DURING_PROCESSING;  // End marker expected
+
+    const uint_fast64_t remaining = decompressed_size & 0x3;
+    if ((uint_fast64_t) (in_end - *in) != remaining)
+        return DENSITY_ALGORITHMS_EXIT_STATUS_ERROR_DURING_PROCESSING;
+    DENSITY_MEMCPY(*out, *in, remaining);
+    *in += remaining;
+    *out += remaining;
+
+    if (state->model)
+        density_lion_form_model_copy((density_lion_form_data *) state->model, &data);
+    state->last_hash = last_hash;
     return DENSITY_ALGORITHMS_EXIT_STATUS_FINISHED;
 }
+
+DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE density_algorithm_exit_status density_lion_decode(density_algorithm_state *const DENSITY_RESTRICT state, const uint8_t **DENSITY_RESTRICT in, const uint_fast64_t in_size, uint8_t **DENSITY_RESTRICT out, const uint_fast64_t out_size) {
+    if (state->decompressed_size) {
+        if (state->static_dictionary)
+            return density_lion_decode_exact_with_epochs(state, in, in_size, out, out_size, NULL, false, state->hash_bits);
+        else if (DENSITY_ALGORITHMS_EPOCHS(state))
+            return density_lion_decode_exact_with_epochs(state, in, in_size, out, out_size, state->epochs, true, state->hash_bits);
+        else
+            return density_lion_decode_exact_with_epochs(state, in, in_size, out, out_size, NULL, true, state->hash_bits);
+    }
+    if (state->static_dictionary)
+        return density_lion_decode_with_epochs(state, in, in_size, out, out_size, NULL, false, state->hash_bits);
+    else if (DENSITY_ALGORITHMS_EPOCHS(state))
+        return density_lion_decode_with_epochs(state, in, in_size, out, out_size, state->epochs, true, state->hash_bits);
+    else
+        return density_lion_decode_with_epochs(state, in, in_size, out, out_size, NULL, true, state->hash_bits);
+}
+
+DENSITY_ALGORITHMS_KERNEL_VARIANTS(density_lion_decode)
@@ -113,18 +113,21 @@ DENSITY_FORCE_INLINE void density_lion_encode_push_code_to_signature(uint8_t **D
     density_lion_encode_push_to_signature(out, signature_pointer, signature, shift, code.value, code.bitLength);
 }
 
-DENSITY_FORCE_INLINE void density_lion_encode_kernel_4(uint8_t **DENSITY_RESTRICT out, uint_fast16_t *DENSITY_RESTRICT last_hash, density_lion_signature **DENSITY_RESTRICT signature_pointer, density_lion_signature *const DENSITY_RESTRICT signature, uint_fast8_t *const DENSITY_RESTRICT shift, density_lion_dictionary *const DENSITY_RESTRICT dictionary, const uint16_t hash, density_lion_form_data *const data, const uint32_t unit) {
-    density_lion_dictionary_chunk_prediction_entry *const predictions = &dictionary->predictions[*last_hash];
-	DENSITY_PREFETCH(&dictionary->predictions[hash]);
+DENSITY_FORCE_INLINE void density_lion_encode_kernel_4(uint8_t **DENSITY_RESTRICT out, uint_fast16_t *DENSITY_RESTRICT last_hash, density_lion_signature **DENSITY_RESTRICT signature_pointer, density_lion_signature *const DENSITY_RESTRICT signature, uint_fast8_t *const DENSITY_RESTRICT shift, density_lion_dictionary *const DENSITY_RESTRICT dictionary, density_algorithm_epochs *const DENSITY_RESTRICT epochs, const bool update, const uint16_t hash, density_lion_form_data *const data, const uint32_t unit) {
+    if (epochs)
+        density_lion_dictionary_touch(dictionary, epochs, hash);
+    density_lion_dictionary_entry *const predictions = &dictionary->entries[*last_hash];
+	DENSITY_PREFETCH(&dictionary->entries[hash]);
 
-    if (*(uint32_t *) predictions ^ unit) {
-        if (*((uint32_t *) predictions + 1) ^ unit) {
-            if (*((uint32_t *) predictions + 2) ^ unit) {
-                density_lion_dictionary_chunk_entry *const in_dictionary = &dictionary->chunks[hash];
-                if (*(uint32_t *) in_dictionary ^ unit) {
-                    if (*((uint32_t *) in_dictionary + 1) ^ unit) {
-                        if (*((uint32_t *) in_dictionary + 2) ^ unit) {
-                            if (*((uint32_t *) in_dictionary + 3) ^ unit) {
+    // Candidates are probed with branches rather than one vector compare, so that speculation runs ahead of the dictionary loads instead of the form model and output waiting on them
+    if (density_lion_dictionary_prediction(predictions, 0) ^ unit) {
+        if (density_lion_dictionary_prediction(predictions, 1) ^ unit) {
+            if (density_lion_dictionary_prediction(predictions, 2) ^ unit) {
+                density_lion_dictionary_entry *const in_dictionary = &dictionary->entries[hash];
+                if (density_lion_dictionary_chunk(in_dictionary, 0) ^ unit) {
+                    if (density_lion_dictionary_chunk(in_dictionary, 1) ^ unit) {
+                        if (density_lion_dictionary_chunk(in_dictionary, 2) ^ unit) {
+                            if (density_lion_dictionary_chunk(in_dictionary, 3) ^ unit) {
                                 density_lion_encode_push_code_to_signature(out, signature_pointer, signature, shift, density_lion_form_model_get_encoding(data, DENSITY_LION_FORM_PLAIN));
                                 DENSITY_MEMCPY(*out, &unit, sizeof(uint32_t));
                                 *out += sizeof(uint32_t);
@@ -164,8 +167,8 @@ DENSITY_FORCE_INLINE void density_lion_encode_kernel_4(uint8_t **DENSITY_RESTRIC
 #endif
                         *out += sizeof(uint16_t);
                     }
-                    DENSITY_MEMMOVE((uint32_t *) in_dictionary + 1, in_dictionary, 3 * sizeof(uint32_t));
-                    *(uint32_t *) in_dictionary = unit; // Does not ensure dictionary content consistency between endiannesses
+                    if (update)
+                        density_lion_dictionary_push_chunk(in_dictionary, unit);
                 } else {
                     density_lion_encode_push_code_to_signature(out, signature_pointer, signature, shift, density_lion_form_model_get_encoding(data, DENSITY_LION_FORM_DICTIONARY_A));
 #ifdef DENSITY_LITTLE_ENDIAN
@@ -184,40 +187,40 @@ DENSITY_FORCE_INLINE void density_lion_encode_kernel_4(uint8_t **DENSITY_RESTRIC
         } else {
             density_lion_encode_push_code_to_signature(out, signature_pointer, signature, shift, density_lion_form_model_get_encoding(data, DENSITY_LION_FORM_PREDICTIONS_B));
         }
-        DENSITY_MEMMOVE((uint32_t *) predictions + 1, predictions, 2 * sizeof(uint32_t));
-        *(uint32_t *) predictions = unit;   // Does not ensure dictionary content consistency between endiannesses
+        if (update)
+            density_lion_dictionary_push_prediction(predictions, unit);
     } else
         density_lion_encode_push_code_to_signature(out, signature_pointer, signature, shift, density_lion_form_model_get_encoding(data, DENSITY_LION_FORM_PREDICTIONS_A));
     *last_hash = hash;
 }
 
-DENSITY_FORCE_INLINE void density_lion_encode_4(const uint8_t **DENSITY_RESTRICT in, uint8_t **DENSITY_RESTRICT out, uint_fast16_t *DENSITY_RESTRICT last_hash, density_lion_signature **DENSITY_RESTRICT signature_pointer, density_lion_signature *const DENSITY_RESTRICT signature, uint_fast8_t *const DENSITY_RESTRICT shift, density_lion_dictionary *const DENSITY_RESTRICT dictionary, density_lion_form_data *const data, uint32_t *DENSITY_RESTRICT unit) {
+DENSITY_FORCE_INLINE void density_lion_encode_4(const uint8_t **DENSITY_RESTRICT in, uint8_t **DENSITY_RESTRICT out, uint_fast16_t *DENSITY_RESTRICT last_hash, density_lion_signature **DENSITY_RESTRICT signature_pointer, density_lion_signature *const DENSITY_RESTRICT signature, uint_fast8_t *const DENSITY_RESTRICT shift, density_lion_dictionary *const DENSITY_RESTRICT dictionary, density_algorithm_epochs *const DENSITY_RESTRICT epochs, const bool update, density_lion_form_data *const data, uint32_t *DENSITY_RESTRICT unit, const uint_fast8_t hash_bits) {
     DENSITY_MEMCPY(unit, *in, sizeof(uint32_t));
-    density_lion_encode_kernel_4(out, last_hash, signature_pointer, signature, shift, dictionary, DENSITY_LION_HASH_ALGORITHM(DENSITY_LITTLE_ENDIAN_32(*unit)), data, *unit);
+    density_lion_encode_kernel_4(out, last_hash, signature_pointer, signature, shift, dictionary, epochs, update, DENSITY_LION_HASH_ALGORITHM(DENSITY_LITTLE_ENDIAN_32(*unit), hash_bits), data, *unit);
     *in += sizeof(uint32_t);
 }
 
-DENSITY_FORCE_INLINE void density_lion_encode_generic(const uint8_t **DENSITY_RESTRICT in, uint8_t **DENSITY_RESTRICT out, uint_fast16_t *DENSITY_RESTRICT last_hash, density_lion_signature **DENSITY_RESTRICT signature_pointer, density_lion_signature *const DENSITY_RESTRICT signature, uint_fast8_t *const DENSITY_RESTRICT shift, density_lion_dictionary *const DENSITY_RESTRICT dictionary, const uint_fast8_t chunks_per_process_unit, density_lion_form_data *const data, uint32_t *DENSITY_RESTRICT unit) {
+DENSITY_FORCE_INLINE void density_lion_encode_generic(const uint8_t **DENSITY_RESTRICT in, uint8_t **DENSITY_RESTRICT out, uint_fast16_t *DENSITY_RESTRICT last_hash, density_lion_signature **DENSITY_RESTRICT signature_pointer, density_lion_signature *const DENSITY_RESTRICT signature, uint_fast8_t *const DENSITY_RESTRICT shift, density_lion_dictionary *const DENSITY_RESTRICT dictionary, density_algorithm_epochs *const DENSITY_RESTRICT epochs, const bool update, const uint_fast8_t chunks_per_process_unit, density_lion_form_data *const data, uint32_t *DENSITY_RESTRICT unit, const uint_fast8_t hash_bits) {
 #ifdef __clang__
     for (uint_fast8_t count = 0; count < (chunks_per_process_unit >> 2); count++) {
-        DENSITY_UNROLL_4(density_lion_encode_4(in, out, last_hash, signature_pointer, signature, shift, dictionary, data, unit));
+        DENSITY_UNROLL_4(density_lion_encode_4(in, out, last_hash, signature_pointer, signature, shift, dictionary, epochs, update, data, unit, hash_bits));
     }
 #else
     for (uint_fast8_t count = 0; count < (chunks_per_process_unit >> 1); count++) {
-        DENSITY_UNROLL_2(density_lion_encode_4(in, out, last_hash, signature_pointer, signature, shift, dictionary, data, unit));
+        DENSITY_UNROLL_2(density_lion_encode_4(in, out, last_hash, signature_pointer, signature, shift, dictionary, epochs, update, data, unit, hash_bits));
     }
 #endif
 }
 
-DENSITY_FORCE_INLINE void density_lion_encode_32(const uint8_t **DENSITY_RESTRICT in, uint8_t **DENSITY_RESTRICT out, uint_fast16_t *DENSITY_RESTRICT last_hash, density_lion_signature **DENSITY_RESTRICT signature_pointer, density_lion_signature *const DENSITY_RESTRICT signature, uint_fast8_t *const DENSITY_RESTRICT shift, density_lion_dictionary *const DENSITY_RESTRICT dictionary, density_lion_form_data *const data, uint32_t *DENSITY_RESTRICT unit) {
-    density_lion_encode_generic(in, out, last_hash, signature_pointer, signature, shift, dictionary, DENSITY_LION_CHUNKS_PER_PROCESS_UNIT_SMALL, data, unit);
+DENSITY_FORCE_INLINE void density_lion_encode_32(const uint8_t **DENSITY_RESTRICT in, uint8_t **DENSITY_RESTRICT out, uint_fast16_t *DENSITY_RESTRICT last_hash, density_lion_signature **DENSITY_RESTRICT signature_pointer, density_lion_signature *const DENSITY_RESTRICT signature, uint_fast8_t *const DENSITY_RESTRICT shift, density_lion_dictionary *const DENSITY_RESTRICT dictionary, density_algorithm_epochs *const DENSITY_RESTRICT epochs, const bool update, density_lion_form_data *const data, uint32_t *DENSITY_RESTRICT unit, const uint_fast8_t hash_bits) {
+    density_lion_encode_generic(in, out, last_hash, signature_pointer, signature, shift, dictionary, epochs, update, DENSITY_LION_CHUNKS_PER_PROCESS_UNIT_SMALL, data, unit, hash_bits);
 }
 
-DENSITY_FORCE_INLINE void density_lion_encode_256(const uint8_t **DENSITY_RESTRICT in, uint8_t **DENSITY_RESTRICT out, uint_fast16_t *DENSITY_RESTRICT last_hash, density_lion_signature **DENSITY_RESTRICT signature_pointer, density_lion_signature *const DENSITY_RESTRICT signature, uint_fast8_t *const DENSITY_RESTRICT shift, density_lion_dictionary *const DENSITY_RESTRICT dictionary, density_lion_form_data *const data, uint32_t *DENSITY_RESTRICT unit) {
-    density_lion_encode_generic(in, out, last_hash, signature_pointer, signature, shift, dictionary, DENSITY_LION_CHUNKS_PER_PROCESS_UNIT_BIG, data, unit);
+DENSITY_FORCE_INLINE void density_lion_encode_256(const uint8_t **DENSITY_RESTRICT in, uint8_t **DENSITY_RESTRICT out, uint_fast16_t *DENSITY_RESTRICT last_hash, density_lion_signature **DENSITY_RESTRICT signature_pointer, density_lion_signature *const DENSITY_RESTRICT signature, uint_fast8_t *const DENSITY_RESTRICT shift, density_lion_dictionary *const DENSITY_RESTRICT dictionary, density_algorithm_epochs *const DENSITY_RESTRICT epochs, const bool update, density_lion_form_data *const data, uint32_t *DENSITY_RESTRICT unit, const uint_fast8_t hash_bits) {
+    density_lion_encode_generic(in, out, last_hash, signature_pointer, signature, shift, dictionary, epochs, update, DENSITY_LION_CHUNKS_PER_PROCESS_UNIT_BIG, data, unit, hash_bits);
 }
 
-DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE density_algorithm_exit_status density_lion_encode(density_algorithm_state *const DENSITY_RESTRICT state, const uint8_t **DENSITY_RESTRICT in, const uint_fast64_t in_size, uint8_t **DENSITY_RESTRICT out, const uint_fast64_t out_size) {
+DENSITY_FORCE_INLINE density_algorithm_exit_status density_lion_encode_with_epochs(density_algorithm_state *const DENSITY_RESTRICT state, const uint8_t **DENSITY_RESTRICT in, const uint_fast64_t in_size, uint8_t **DENSITY_RESTRICT out, const uint_fast64_t out_size, density_algorithm_epochs *const DENSITY_RESTRICT epochs, const bool update, const uint_fast8_t hash_bits) {
     if (out_size < DENSITY_LION_MAXIMUM_COMPRESSED_UNIT_SIZE)
         return DENSITY_ALGORITHMS_EXIT_STATUS_OUTPUT_STALL;
 
@@ -225,13 +228,19 @@ DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE density_algorithm_exit_status densit
     density_lion_signature *signature_pointer = NULL;
     uint_fast8_t shift = 0;
     density_lion_form_data data;
-    density_lion_form_model_init(&data);
-    uint_fast16_t last_hash = 0;
+    if (state->model)
+        density_lion_form_model_copy(&data, (density_lion_form_data *) state->model);
+    else
+        density_lion_form_model_init(&data);
+    uint_fast16_t last_hash = state->last_hash;
     uint32_t unit;
 
     uint8_t *out_limit = *out + out_size - DENSITY_LION_MAXIMUM_COMPRESSED_UNIT_SIZE;
     uint_fast64_t limit_256 = (in_size >> 8);
 
+    if (epochs)
+        density_lion_dictionary_touch((density_lion_dictionary *const) state->dictionary, epochs, last_hash);
+
     while (DENSITY_LIKELY(limit_256-- && *out <= out_limit)) {
         if (DENSITY_UNLIKELY(!(state->counter & 0xf))) {
             DENSITY_ALGORITHM_REDUCE_COPY_PENALTY_START;
@@ -243,7 +252,7 @@ DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE density_algorithm_exit_status densit
         } else {
             const uint8_t *out_start = *out;
             DENSITY_PREFETCH(*in + DENSITY_LION_WORK_BLOCK_SIZE);
-            density_lion_encode_256(in, out, &last_hash, &signature_pointer, &signature, &shift, (density_lion_dictionary *const) state->dictionary, &data, &unit);
+            density_lion_encode_256(in, out, &last_hash, &signature_pointer, &signature, &shift, (density_lion_dictionary *const) state->dictionary, epochs, update, &data, &unit, hash_bits);
             DENSITY_ALGORITHM_TEST_INCOMPRESSIBILITY((*out - out_start), DENSITY_LION_WORK_BLOCK_SIZE);
         }
     }
@@ -274,7 +283,7 @@ DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE density_algorithm_exit_status densit
 
     uint_fast64_t limit_4 = (in_size & 0xff) >> 2;
     while (limit_4--)
-        density_lion_encode_4(in, out, &last_hash, &signature_pointer, &signature, &shift, (density_lion_dictionary *const) state->dictionary, &data, &unit);
+        density_lion_encode_4(in, out, &last_hash, &signature_pointer, &signature, &shift, (density_lion_dictionary *const) state->dictionary, epochs, update, &data, &unit, hash_bits);
 
     density_lion_encode_push_code_to_signature(out, &signature_pointer, &signature, &shift, density_lion_form_model_get_encoding(&data, DENSITY_LION_FORM_PLAIN)); // End marker
 #ifdef DENSITY_LITTLE_ENDIAN
@@ -294,5 +303,19 @@ DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE density_algorithm_exit_status densit
         *out += remaining;
     }
 
+    if (state->model)
+        density_lion_form_model_copy((density_lion_form_data *) state->model, &data);
+    state->last_hash = last_hash;
     return DENSITY_ALGORITHMS_EXIT_STATUS_FINISHED;
 }
+
+DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE density_algorithm_exit_status density_lion_encode(density_algorithm_state *const DENSITY_RESTRICT state, const uint8_t **DENSITY_RESTRICT in, const uint_fast64_t in_size, uint8_t **DENSITY_RESTRICT out, const uint_fast64_t out_size) {
+    if (state->static_dictionary)
+        return density_lion_encode_with_epochs(state, in, in_size, out, out_size, NULL, false, state->hash_bits);
+    else if (DENSITY_ALGORITHMS_EPOCHS(state))
+        return density_lion_encode_with_epochs(state, in, in_size, out, out_size, state->epochs, true, state->hash_bits);
+    else
+        return density_lion_encode_with_epochs(state, in, in_size, out, out_size, NULL, true, state->hash_bits);
+}
+
+DENSITY_ALGORITHMS_KERNEL_VARIANTS(density_lion_encode)
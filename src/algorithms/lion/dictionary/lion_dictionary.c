@@ -0,0 +1,86 @@
+/*
+ * Centaurean Density
+ *
+ * Copyright (c) 2015, Guillaume Voirin
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     1. Redistributions of source code must retain the above copyright notice, this
+ *        list of conditions and the following disclaimer.
+ *
+ *     2. Redistributions in binary form must reproduce the above copyright notice,
+ *        this list of conditions and the following disclaimer in the documentation
+ *        and/or other materials provided with the distribution.
+ *
+ *     3. Neither the name of the copyright holder nor the names of its
+ *        contributors may be used to endorse or promote products derived from
+ *        this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * 17/10/26 04:46
+ *
+ * --------------
+ * Lion algorithm
+ * --------------
+ *
+ * Author(s)
+ * Guillaume Voirin (https://github.com/gpnuma)
+ *
+ * Description
+ * Multiform compression algorithm
+ */
+
+#include "lion_dictionary.h"
+
+DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE size_t density_lion_dictionary_size(const uint_fast8_t hash_bits) {
+    return sizeof(density_lion_dictionary_entry) << hash_bits;
+}
+
+DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE uint32_t density_lion_dictionary_chunk(const density_lion_dictionary_entry *const entry, const uint_fast8_t rank) {
+    return entry->chunks[rank];
+}
+
+DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE uint32_t density_lion_dictionary_prediction(const density_lion_dictionary_entry *const entry, const uint_fast8_t rank) {
+    return entry->predictions[rank];
+}
+
+DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE void density_lion_dictionary_push_chunk(density_lion_dictionary_entry *const entry, const uint32_t chunk) {
+    const uint32_t chunk_a = entry->chunks[0];
+    const uint32_t chunk_b = entry->chunks[1];
+    const uint32_t chunk_c = entry->chunks[2];
+    entry->chunks[0] = chunk;   // Does not ensure dictionary content consistency between endiannesses
+    entry->chunks[1] = chunk_a;
+    entry->chunks[2] = chunk_b;
+    entry->chunks[3] = chunk_c;
+}
+
+DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE void density_lion_dictionary_push_prediction(density_lion_dictionary_entry *const entry, const uint32_t chunk) {
+    const uint32_t prediction_a = entry->predictions[0];
+    const uint32_t prediction_b = entry->predictions[1];
+    entry->predictions[0] = chunk;  // Does not ensure dictionary content consistency between endiannesses
+    entry->predictions[1] = prediction_a;
+    entry->predictions[2] = prediction_b;
+}
+
+DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE void density_lion_dictionary_touch(density_lion_dictionary *const DENSITY_RESTRICT dictionary, density_algorithm_epochs *const DENSITY_RESTRICT epochs, const uint_fast16_t hash) {
+    const uint_fast16_t page = hash >> DENSITY_ALGORITHMS_EPOCHS_PAGE_BITS;
+    if (DENSITY_LIKELY(epochs->pages[page] == epochs->current))
+        return;
+    if (epochs->base)
+        DENSITY_MEMCPY(&dictionary->entries[page << DENSITY_ALGORITHMS_EPOCHS_PAGE_BITS], &((const density_lion_dictionary *) epochs->base)->entries[page << DENSITY_ALGORITHMS_EPOCHS_PAGE_BITS], sizeof(density_lion_dictionary_entry) << DENSITY_ALGORITHMS_EPOCHS_PAGE_BITS);
+    else
+        DENSITY_MEMSET(&dictionary->entries[page << DENSITY_ALGORITHMS_EPOCHS_PAGE_BITS], 0, sizeof(density_lion_dictionary_entry) << DENSITY_ALGORITHMS_EPOCHS_PAGE_BITS);
+    epochs->pages[page] = epochs->current;
+}
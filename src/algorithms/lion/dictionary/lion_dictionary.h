@@ -46,28 +46,42 @@
 #define DENSITY_LION_DICTIONARY_H
 
 #include "../lion.h"
+#include "../../algorithms.h"
+
+#define DENSITY_LION_DICTIONARY_CHUNKS                                  4
+#define DENSITY_LION_DICTIONARY_PREDICTIONS                             3
 
 #pragma pack(push)
 #pragma pack(4)
 
+/*
+ * Chunks of a hash are probed right before its predictions are, both share a 32 bytes entry so that one cache line serves the two lookups.
+ * Slots are kept in most recently used order
+ */
 typedef struct {
-    uint32_t chunk_a;
-    uint32_t chunk_b;
-    uint32_t chunk_c;
-    uint32_t chunk_d;
-    uint32_t chunk_e;
-} density_lion_dictionary_chunk_entry;
-
-typedef struct {
-    uint32_t next_chunk_a;
-    uint32_t next_chunk_b;
-    uint32_t next_chunk_c;
-} density_lion_dictionary_chunk_prediction_entry;
+    uint32_t chunks[DENSITY_LION_DICTIONARY_CHUNKS];
+    uint32_t predictions[DENSITY_LION_DICTIONARY_PREDICTIONS];
+    uint32_t padding;
+} density_lion_dictionary_entry;
 
+/*
+ * Only the first 1 << hash_bits entries are allocated
+ */
 typedef struct {
-    density_lion_dictionary_chunk_entry chunks[1 << DENSITY_LION_CHUNK_HASH_BITS];
-    density_lion_dictionary_chunk_prediction_entry predictions[1 << DENSITY_LION_CHUNK_HASH_BITS];
+    density_lion_dictionary_entry entries[1 << DENSITY_HASH_BITS_MAXIMUM];
 } density_lion_dictionary;
 #pragma pack(pop)
 
+DENSITY_WINDOWS_EXPORT size_t density_lion_dictionary_size(const uint_fast8_t);
+
+DENSITY_WINDOWS_EXPORT uint32_t density_lion_dictionary_chunk(const density_lion_dictionary_entry *const, const uint_fast8_t);
+
+DENSITY_WINDOWS_EXPORT uint32_t density_lion_dictionary_prediction(const density_lion_dictionary_entry *const, const uint_fast8_t);
+
+DENSITY_WINDOWS_EXPORT void density_lion_dictionary_push_chunk(density_lion_dictionary_entry *const, const uint32_t);
+
+DENSITY_WINDOWS_EXPORT void density_lion_dictionary_push_prediction(density_lion_dictionary_entry *const, const uint32_t);
+
+DENSITY_WINDOWS_EXPORT void density_lion_dictionary_touch(density_lion_dictionary *const DENSITY_RESTRICT_DECLARE, density_algorithm_epochs *const DENSITY_RESTRICT_DECLARE, const uint_fast16_t);
+
 #endif
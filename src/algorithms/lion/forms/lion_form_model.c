@@ -98,9 +98,14 @@ DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE void density_lion_form_model_init(de
     data->usages.usages_as_uint64_t = 0;
 }
 
-DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE void density_lion_form_model_attach(density_lion_form_data *const data, void (*attachments[DENSITY_LION_NUMBER_OF_FORMS])(const uint8_t **, uint8_t **, uint_fast16_t *, void *const, uint16_t *const, uint32_t *const)) {
-    for(uint_fast8_t count = 0; count < DENSITY_LION_NUMBER_OF_FORMS; count ++)
-        data->attachments[count] = attachments[count];
+DENSITY_WINDOWS_EXPORT void density_lion_form_model_copy(density_lion_form_data *const DENSITY_RESTRICT destination, const density_lion_form_data *const DENSITY_RESTRICT source) {
+    DENSITY_MEMCPY(destination, source, sizeof(density_lion_form_data));
+
+    // Nodes point into their own pool
+    for (uint_fast8_t rank = 0; rank < DENSITY_LION_NUMBER_OF_FORMS; rank++) {
+        destination->formsPool[rank].previousForm = rank ? &destination->formsPool[rank - 1] : NULL;
+        destination->formsIndex[rank] = destination->formsPool + (source->formsIndex[rank] - source->formsPool);
+    }
 }
 
 DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE void density_lion_form_model_update(density_lion_form_data *const DENSITY_RESTRICT data, density_lion_form_node *const DENSITY_RESTRICT form, const uint8_t usage, density_lion_form_node *const DENSITY_RESTRICT previous_form, const uint8_t previous_usage) {
@@ -76,7 +76,6 @@ typedef struct {
         uint64_t usages_as_uint64_t;
     } usages;
 
-    void (*attachments[DENSITY_LION_NUMBER_OF_FORMS])(const uint8_t **, uint8_t **, uint_fast16_t *, void *const, uint16_t *const, uint32_t *const);
     density_lion_form_node formsPool[DENSITY_LION_NUMBER_OF_FORMS];
     density_lion_form_node *formsIndex[DENSITY_LION_NUMBER_OF_FORMS];
     uint8_t nextAvailableForm;
@@ -85,7 +84,7 @@ typedef struct {
 
 DENSITY_WINDOWS_EXPORT void density_lion_form_model_init(density_lion_form_data *const);
 
-DENSITY_WINDOWS_EXPORT void density_lion_form_model_attach(density_lion_form_data *const, void (*[DENSITY_LION_NUMBER_OF_FORMS])(const uint8_t **, uint8_t **, uint_fast16_t *, void *const, uint16_t *const, uint32_t *const));
+DENSITY_WINDOWS_EXPORT void density_lion_form_model_copy(density_lion_form_data *const DENSITY_RESTRICT_DECLARE, const density_lion_form_data *const DENSITY_RESTRICT_DECLARE);
 
 DENSITY_WINDOWS_EXPORT void density_lion_form_model_update(density_lion_form_data *const DENSITY_RESTRICT_DECLARE, density_lion_form_node *const DENSITY_RESTRICT_DECLARE, const uint8_t, density_lion_form_node *const DENSITY_RESTRICT_DECLARE, const uint8_t);
 
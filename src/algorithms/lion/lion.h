@@ -48,9 +48,8 @@
 #include "../../globals.h"
 
 #define DENSITY_LION_HASH32_MULTIPLIER                                  (uint32_t)0x9D6EF916lu
-#define DENSITY_LION_CHUNK_HASH_BITS                                    16
 
-#define DENSITY_LION_HASH_ALGORITHM(value32)                            (uint16_t)(value32 * DENSITY_LION_HASH32_MULTIPLIER >> (32 - DENSITY_LION_CHUNK_HASH_BITS))
+#define DENSITY_LION_HASH_ALGORITHM(value32, hash_bits)                 (uint16_t)(value32 * DENSITY_LION_HASH32_MULTIPLIER >> (32 - (hash_bits)))
 
 typedef enum {
     DENSITY_LION_FORM_PREDICTIONS_A = 0,
@@ -0,0 +1,65 @@
+/*
+ * Centaurean Density
+ *
+ * Copyright (c) 2013, Guillaume Voirin
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     1. Redistributions of source code must retain the above copyright notice, this
+ *        list of conditions and the following disclaimer.
+ *
+ *     2. Redistributions in binary form must reproduce the above copyright notice,
+ *        this list of conditions and the following disclaimer in the documentation
+ *        and/or other materials provided with the distribution.
+ *
+ *     3. Neither the name of the copyright holder nor the names of its
+ *        contributors may be used to endorse or promote products derived from
+ *        this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * 17/10/26 10:07
+ */
+
+#include "batch.h"
+
+DENSITY_WINDOWS_EXPORT DENSITY_STATE density_compress_batch(const density_batch_item *items, const uint_fast64_t count, const DENSITY_ALGORITHM algorithm, density_processing_result *results) {
+    if (!density_get_dictionary_size(algorithm))
+        return DENSITY_STATE_ERROR_INVALID_ALGORITHM;
+
+    // Every item is an independent frame, encoded with the same cached dictionary after a lazy reset
+    DENSITY_STATE batch_state = DENSITY_STATE_OK;
+    for (uint_fast64_t item = 0; item < count; item++) {
+        density_context *const context = density_cached_context(algorithm, DENSITY_HASH_BITS_DEFAULT, items[item].input_size);
+        if (context == NULL)
+            results[item] = density_make_result(DENSITY_STATE_ERROR_INVALID_CONTEXT, 0, 0, NULL);
+        else {
+            results[item] = density_compress_with_context(items[item].input_buffer, items[item].input_size, items[item].output_buffer, items[item].output_size, context);
+            results[item].context = NULL;
+        }
+        if (results[item].state && !batch_state)
+            batch_state = results[item].state;
+    }
+    return batch_state;
+}
+
+DENSITY_WINDOWS_EXPORT DENSITY_STATE density_decompress_batch(const density_batch_item *items, const uint_fast64_t count, density_processing_result *results) {
+    DENSITY_STATE batch_state = DENSITY_STATE_OK;
+    for (uint_fast64_t item = 0; item < count; item++) {
+        results[item] = density_decompress_cached(items[item].input_buffer, items[item].input_size, items[item].output_buffer, items[item].output_size);
+        if (results[item].state && !batch_state)
+            batch_state = results[item].state;
+    }
+    return batch_state;
+}
@@ -40,6 +40,8 @@ DENSITY_WINDOWS_EXPORT uint_fast64_t density_compress_safe_size(const uint_fast6
     // Chameleon longest output
     uint_fast64_t chameleon_longest_output_size = 0;
     chameleon_longest_output_size += sizeof(density_header);
+    chameleon_longest_output_size += sizeof(density_frame_content_size);
+    chameleon_longest_output_size += sizeof(density_frame_dictionary_id);
     chameleon_longest_output_size += sizeof(density_chameleon_signature) * (1 + (input_size >> (5 + 3)));   // Signature space (1 bit <=> 4 bytes)
     chameleon_longest_output_size += sizeof(density_chameleon_signature);                                   // Eventual supplementary signature for end marker
     chameleon_longest_output_size += input_size;                                                            // Everything encoded as plain data
@@ -47,6 +49,8 @@ DENSITY_WINDOWS_EXPORT uint_fast64_t density_compress_safe_size(const uint_fast6
     // Cheetah longest output
     uint_fast64_t cheetah_longest_output_size = 0;
     cheetah_longest_output_size += sizeof(density_header);
+    cheetah_longest_output_size += sizeof(density_frame_content_size);
+    cheetah_longest_output_size += sizeof(density_frame_dictionary_id);
     cheetah_longest_output_size += sizeof(density_cheetah_signature) * (1 + (input_size >> (4 + 3)));       // Signature space (2 bits <=> 4 bytes)
     cheetah_longest_output_size += sizeof(density_cheetah_signature);                                       // Eventual supplementary signature for end marker
     cheetah_longest_output_size += input_size;                                                              // Everything encoded as plain data
@@ -54,6 +58,8 @@ DENSITY_WINDOWS_EXPORT uint_fast64_t density_compress_safe_size(const uint_fast6
     // Lion longest output
     uint_fast64_t lion_longest_output_size = 0;
     lion_longest_output_size += sizeof(density_header);
+    lion_longest_output_size += sizeof(density_frame_content_size);
+    lion_longest_output_size += sizeof(density_frame_dictionary_id);
     lion_longest_output_size += sizeof(density_lion_signature) * (1 + ((input_size * 7) >> (5 + 3)));       // Signature space (7 bits <=> 4 bytes), although this size is technically impossible
     lion_longest_output_size += sizeof(density_lion_signature);                                             // Eventual supplementary signature for end marker
     lion_longest_output_size += input_size;                                                                 // Everything encoded as plain data
@@ -67,7 +73,69 @@ DENSITY_WINDOWS_EXPORT uint_fast64_t density_decompress_safe_size(const uint_fas
     return expected_decompressed_output_size + slack;
 }
 
-DENSITY_FORCE_INLINE DENSITY_STATE density_convert_algorithm_exit_status(const density_algorithm_exit_status status) {
+DENSITY_WINDOWS_EXPORT DENSITY_STATE density_get_frame_info(const uint8_t *input_buffer, const uint_fast64_t input_size, density_frame_info *const info) {
+    const uint8_t *in = input_buffer;
+    density_header main_header;
+    uint_fast64_t content_size;
+    uint_fast32_t dictionary_id;
+    const DENSITY_STATE state = density_frame_read(&in, input_size, &main_header, &content_size, &dictionary_id);
+    if (state)
+        return state;
+
+    info->algorithm = (DENSITY_ALGORITHM) main_header.algorithm;
+    info->hash_bits = main_header.hash_bits;
+    info->content_size_known = (main_header.flags & (DENSITY_HEADER_FLAG_CONTENT_SIZE | DENSITY_HEADER_FLAG_BLOCKS)) != 0;
+    info->content_size = content_size;
+    info->block_size = 0;
+    if (main_header.flags & DENSITY_HEADER_FLAG_BLOCKS) {
+        const uint8_t *descriptor_in = in;
+        density_blocks_descriptor descriptor;
+        density_blocks_descriptor_read(&descriptor_in, &descriptor);
+        info->block_size = descriptor.block_size;
+    }
+    info->segmented = (main_header.flags & DENSITY_HEADER_FLAG_SEGMENTS) != 0;
+    info->header_size = (uint_fast64_t) (in - input_buffer);
+    info->dictionary_id = dictionary_id;
+    info->static_dictionary = (main_header.flags & DENSITY_HEADER_FLAG_STATIC_DICTIONARY) != 0;
+    return DENSITY_STATE_OK;
+}
+
+DENSITY_WINDOWS_EXPORT uint_fast64_t density_metadata_frame_size(const uint_fast32_t metadata_size) {
+    return sizeof(density_header) + sizeof(density_frame_metadata_size) + metadata_size;
+}
+
+DENSITY_WINDOWS_EXPORT density_processing_result density_write_metadata_frame(const uint8_t *metadata, const uint_fast32_t metadata_size, uint8_t *output_buffer, const uint_fast64_t output_size) {
+    if (output_size < density_metadata_frame_size(metadata_size))
+        return density_make_result(DENSITY_STATE_ERROR_OUTPUT_BUFFER_TOO_SMALL, 0, 0, NULL);
+
+    uint8_t *out = output_buffer;
+    density_frame_metadata_write(&out, metadata, metadata_size);
+    return density_make_result(DENSITY_STATE_OK, metadata_size, out - output_buffer, NULL);
+}
+
+DENSITY_WINDOWS_EXPORT density_processing_result density_read_metadata_frame(const uint8_t *input_buffer, const uint_fast64_t input_size, const uint8_t **metadata, uint_fast32_t *metadata_size) {
+    if (input_size < sizeof(density_header) + sizeof(density_frame_metadata_size))
+        return density_make_result(DENSITY_STATE_ERROR_INPUT_BUFFER_TOO_SMALL, 0, 0, NULL);
+
+    const uint8_t *in = input_buffer;
+    density_header main_header;
+    density_header_read(&in, &main_header);
+    if (!(main_header.flags & DENSITY_HEADER_FLAG_METADATA) || main_header.version[0] > DENSITY_MAJOR_VERSION)
+        return density_make_result(DENSITY_STATE_ERROR_INVALID_HEADER, 0, 0, NULL);
+
+    density_frame_metadata_size endian_metadata_size;
+    DENSITY_MEMCPY(&endian_metadata_size, in, sizeof(density_frame_metadata_size));
+    in += sizeof(density_frame_metadata_size);
+    const uint_fast32_t size = DENSITY_LITTLE_ENDIAN_32(endian_metadata_size);
+    if (input_size - (in - input_buffer) < size)
+        return density_make_result(DENSITY_STATE_ERROR_INPUT_BUFFER_TOO_SMALL, in - input_buffer, 0, NULL);
+
+    *metadata = in;
+    *metadata_size = size;
+    return density_make_result(DENSITY_STATE_OK, in - input_buffer + size, size, NULL);
+}
+
+DENSITY_WINDOWS_EXPORT DENSITY_STATE density_convert_algorithm_exit_status(const density_algorithm_exit_status status) {
     switch (status) {
         case DENSITY_ALGORITHMS_EXIT_STATUS_FINISHED:
             return DENSITY_STATE_OK;
@@ -80,7 +148,7 @@ DENSITY_FORCE_INLINE DENSITY_STATE density_convert_algorithm_exit_status(const d
     }
 }
 
-DENSITY_FORCE_INLINE density_processing_result density_make_result(const DENSITY_STATE state, const uint_fast64_t read, const uint_fast64_t written, density_context *const context) {
+DENSITY_WINDOWS_EXPORT density_processing_result density_make_result(const DENSITY_STATE state, const uint_fast64_t read, const uint_fast64_t written, density_context *const context) {
     density_processing_result result;
     result.state = state;
     result.bytesRead = read;
@@ -89,38 +157,184 @@ DENSITY_FORCE_INLINE density_processing_result density_make_result(const DENSITY
     return result;
 }
 
-DENSITY_FORCE_INLINE density_context* density_allocate_context(const DENSITY_ALGORITHM algorithm, const bool custom_dictionary, void *(*mem_alloc)(size_t)) {
+DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE void density_context_set_frame(density_context *const context, const uint8_t flags, const uint_fast64_t content_size, const uint_fast32_t dictionary_id) {
+    context->header_flags = flags;
+    context->content_size = content_size;
+    context->header_dictionary_id = dictionary_id;
+}
+
+DENSITY_FORCE_INLINE density_context* density_allocate_context(const DENSITY_ALGORITHM algorithm, const uint8_t hash_bits, const bool custom_dictionary, void *(*mem_alloc)(size_t)) {
     density_context* context = mem_alloc(sizeof(density_context));
+    if(context == NULL)
+        return NULL;
     context->algorithm = algorithm;
-    context->dictionary_size = density_get_dictionary_size(context->algorithm);
+    context->hash_bits = hash_bits;
+    context->dictionary_size = density_get_dictionary_size_with_hash_bits(context->algorithm, context->hash_bits);
     context->dictionary_type = custom_dictionary;
+    context->dictionary = NULL;
+    context->dictionary_epochs = NULL;
+    context->dictionary_pages = false;
+    context->dictionary_image = NULL;
+    context->dictionary_id = 0;
+    context->dictionary_static = false;
+    context->dictionary_snapshot = NULL;
+    density_context_set_frame(context, 0, 0, 0);
+    context->session_open = false;
+    context->session_sequence = 0;
     if(!context->dictionary_type) {
         context->dictionary = mem_alloc(context->dictionary_size);
-        DENSITY_MEMSET(context->dictionary, 0, context->dictionary_size);
+        if(context->dictionary != NULL)
+            DENSITY_MEMSET(context->dictionary, 0, context->dictionary_size);
     }
     return context;
 }
 
 DENSITY_WINDOWS_EXPORT void density_free_context(density_context *const context, void (*mem_free)(void *)) {
+    if(context == NULL)
+        return;
     if(mem_free == NULL)
         mem_free = free;
-    if(!context->dictionary_type)
+    if(context->dictionary_pages)
+        density_free_pages(context->dictionary, context->dictionary_size);
+    else if(!context->dictionary_type)
         mem_free(context->dictionary);
+    if(context->dictionary_epochs != NULL)
+        mem_free(context->dictionary_epochs);
+    if(context->dictionary_snapshot != NULL)
+        mem_free(context->dictionary_snapshot);
     mem_free(context);
 }
 
+DENSITY_WINDOWS_EXPORT DENSITY_STATE density_enable_lazy_reset(density_context *const context, void *(*mem_alloc)(size_t)) {
+    if(context == NULL)
+        return DENSITY_STATE_ERROR_INVALID_CONTEXT;
+    if(context->dictionary_epochs != NULL)
+        return DENSITY_STATE_OK;
+    if(mem_alloc == NULL)
+        mem_alloc = malloc;
+
+    context->dictionary_epochs = mem_alloc(sizeof(density_algorithm_epochs));
+    if(context->dictionary_epochs == NULL)
+        return DENSITY_STATE_ERROR_DURING_PROCESSING;
+    density_algorithms_epochs_init((density_algorithm_epochs *) context->dictionary_epochs);
+    ((density_algorithm_epochs *) context->dictionary_epochs)->base = (const uint8_t *) context->dictionary_image;
+    return DENSITY_STATE_OK;
+}
+
+DENSITY_WINDOWS_EXPORT DENSITY_STATE density_enable_huge_pages(density_context *const context, void (*mem_free)(void *)) {
+    if(context == NULL || context->dictionary_type)
+        return DENSITY_STATE_ERROR_INVALID_CONTEXT;
+    if(context->dictionary_pages)
+        return DENSITY_STATE_OK;
+    if(mem_free == NULL)
+        mem_free = free;
+
+    void *const dictionary = density_allocate_pages(context->dictionary_size);
+    if(dictionary == NULL)
+        return DENSITY_STATE_ERROR_DURING_PROCESSING;
+    DENSITY_MEMCPY(dictionary, context->dictionary, context->dictionary_size);
+    mem_free(context->dictionary);
+    context->dictionary = dictionary;
+    context->dictionary_pages = true;
+    return DENSITY_STATE_OK;
+}
+
+DENSITY_WINDOWS_EXPORT DENSITY_STATE density_reset_context_for_size(density_context *const context, const uint_fast64_t data_size) {
+    if(context->dictionary_static)
+        return DENSITY_STATE_OK;    // Static dictionaries never change
+    if(context->dictionary == NULL)
+        return DENSITY_STATE_ERROR_INVALID_CONTEXT;     // Custom dictionary not provided yet
+
+    density_algorithm_epochs *const epochs = (density_algorithm_epochs *) context->dictionary_epochs;
+    if(epochs != NULL) {
+        epochs->base = (const uint8_t *) context->dictionary_image;
+        if(data_size < context->dictionary_size) {
+            density_algorithms_epochs_advance(epochs);
+            return DENSITY_STATE_OK;
+        }
+    }
+
+    // Clearing the dictionary at once is cheaper than checking pages as they are used once data outgrows it
+    if(context->dictionary_image != NULL)
+        DENSITY_MEMCPY(context->dictionary, context->dictionary_image, context->dictionary_size);
+    else
+        DENSITY_MEMSET(context->dictionary, 0, context->dictionary_size);
+    if(epochs != NULL)
+        density_algorithms_epochs_refresh(epochs, context->hash_bits);
+    return DENSITY_STATE_OK;
+}
+
+DENSITY_WINDOWS_EXPORT DENSITY_STATE density_reset_context(density_context *const context) {
+    return density_reset_context_for_size(context, 0);
+}
+
+DENSITY_WINDOWS_EXPORT DENSITY_STATE density_context_snapshot(density_context *const context, void *(*mem_alloc)(size_t)) {
+    if(context == NULL || context->dictionary_static || context->dictionary == NULL)
+        return DENSITY_STATE_ERROR_INVALID_CONTEXT;
+    if(mem_alloc == NULL)
+        mem_alloc = malloc;
+
+    // Restores copy back the pages used since, which lazy dictionary reset keeps track of
+    const bool lazy_reset = context->dictionary_epochs != NULL;
+    const DENSITY_STATE state = density_enable_lazy_reset(context, mem_alloc);
+    if(state)
+        return state;
+    const size_t dictionary_size = density_get_dictionary_size_with_hash_bits(context->algorithm, context->hash_bits);
+    if(context->dictionary_snapshot == NULL) {
+        context->dictionary_snapshot = mem_alloc(dictionary_size);
+        if(context->dictionary_snapshot == NULL)
+            return DENSITY_STATE_ERROR_DURING_PROCESSING;
+    }
+
+    density_algorithm_epochs *const epochs = (density_algorithm_epochs *) context->dictionary_epochs;
+    if(lazy_reset)
+        density_algorithms_epochs_flush(context->algorithm, context->dictionary, epochs, context->hash_bits);
+    else
+        density_algorithms_epochs_refresh(epochs, context->hash_bits);     // Dictionary memory is up to date already
+    DENSITY_MEMCPY(context->dictionary_snapshot, context->dictionary, dictionary_size);
+    epochs->base = (const uint8_t *) context->dictionary_snapshot;
+    return DENSITY_STATE_OK;
+}
+
+DENSITY_WINDOWS_EXPORT DENSITY_STATE density_context_restore(density_context *const context) {
+    if(context == NULL || context->dictionary_snapshot == NULL)
+        return DENSITY_STATE_ERROR_INVALID_CONTEXT;
+
+    density_algorithm_epochs *const epochs = (density_algorithm_epochs *) context->dictionary_epochs;
+    epochs->base = (const uint8_t *) context->dictionary_snapshot;
+    density_algorithms_epochs_advance(epochs);
+    return DENSITY_STATE_OK;
+}
+
+DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE void density_context_prepare_state(density_context *const context, density_algorithm_state *const state) {
+    if(context->dictionary_static) {
+        // Kernels only read static dictionaries, straight from the image
+        density_algorithms_prepare_state(state, (void *) context->dictionary_image, context->hash_bits);
+        state->static_dictionary = true;
+    } else {
+        density_algorithms_prepare_state(state, context->dictionary, context->hash_bits);
+        state->epochs = (density_algorithm_epochs *) context->dictionary_epochs;
+    }
+}
+
 DENSITY_WINDOWS_EXPORT density_processing_result density_compress_prepare_context(const DENSITY_ALGORITHM algorithm, const bool custom_dictionary, void *(*mem_alloc)(size_t)) {
+    return density_compress_prepare_context_with_hash_bits(algorithm, DENSITY_HASH_BITS_DEFAULT, custom_dictionary, mem_alloc);
+}
+
+DENSITY_WINDOWS_EXPORT density_processing_result density_compress_prepare_context_with_hash_bits(const DENSITY_ALGORITHM algorithm, const uint8_t hash_bits, const bool custom_dictionary, void *(*mem_alloc)(size_t)) {
+    if(hash_bits < DENSITY_HASH_BITS_MINIMUM || hash_bits > DENSITY_HASH_BITS_MAXIMUM)
+        return density_make_result(DENSITY_STATE_ERROR_INVALID_HASH_BITS, 0, 0, NULL);
     if(mem_alloc == NULL)
         mem_alloc = malloc;
 
-    return density_make_result(DENSITY_STATE_OK, 0, 0, density_allocate_context(algorithm, custom_dictionary, mem_alloc));
+    return density_make_result(DENSITY_STATE_OK, 0, 0, density_allocate_context(algorithm, hash_bits, custom_dictionary, mem_alloc));
 }
 
-DENSITY_WINDOWS_EXPORT density_processing_result density_compress_with_context(const uint8_t * input_buffer, const uint_fast64_t input_size, uint8_t * output_buffer, const uint_fast64_t output_size, density_context *const context) {
-    if (output_size < sizeof(density_header))
-        return density_make_result(DENSITY_STATE_ERROR_OUTPUT_BUFFER_TOO_SMALL, 0, 0, context);
+DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE density_processing_result density_compress_frame(const uint8_t * input_buffer, const uint_fast64_t input_size, uint8_t * output_buffer, const uint_fast64_t output_size, density_context *const context, const uint8_t flags) {
     if(context == NULL)
         return density_make_result(DENSITY_STATE_ERROR_INVALID_CONTEXT, 0, 0, context);
+    if (output_size < sizeof(density_header) + sizeof(density_frame_content_size) + (context->dictionary_image != NULL ? sizeof(density_frame_dictionary_id) : 0))
+        return density_make_result(DENSITY_STATE_ERROR_OUTPUT_BUFFER_TOO_SMALL, 0, 0, context);
 
     // Variables setup
     const uint8_t *in = input_buffer;
@@ -129,30 +343,28 @@ DENSITY_WINDOWS_EXPORT density_processing_result density_compress_with_context(c
     density_algorithm_exit_status status = DENSITY_ALGORITHMS_EXIT_STATUS_ERROR_DURING_PROCESSING;
 
     // Header
-    density_header_write(&out, context->algorithm);
+    if (context->dictionary_image != NULL) {
+        density_header_write(&out, context->algorithm, flags | DENSITY_HEADER_FLAG_CONTENT_SIZE | DENSITY_HEADER_FLAG_DICTIONARY | (context->dictionary_static ? DENSITY_HEADER_FLAG_STATIC_DICTIONARY : 0), context->hash_bits);
+        density_frame_content_size_write(&out, input_size);
+        density_frame_dictionary_id_write(&out, context->dictionary_id);
+    } else {
+        density_header_write(&out, context->algorithm, flags | DENSITY_HEADER_FLAG_CONTENT_SIZE, context->hash_bits);
+        density_frame_content_size_write(&out, input_size);
+    }
 
     // Compression
-    density_algorithms_prepare_state(&state, context->dictionary);
-    switch (context->algorithm) {
-        case DENSITY_ALGORITHM_CHAMELEON:
-            status = density_chameleon_encode(&state, &in, input_size, &out, output_size);
-            break;
-        case DENSITY_ALGORITHM_CHEETAH:
-            status = density_cheetah_encode(&state, &in, input_size, &out, output_size);
-            break;
-        case DENSITY_ALGORITHM_LION:
-            status = density_lion_encode(&state, &in, input_size, &out, output_size);
-            break;
-    }
+    density_context_prepare_state(context, &state);
+    status = density_algorithms_encode(&state, context->algorithm, &in, input_size, &out, output_size - (out - output_buffer));
 
     // Result
     return density_make_result(density_convert_algorithm_exit_status(status), in - input_buffer, out - output_buffer, context);
 }
 
-DENSITY_WINDOWS_EXPORT density_processing_result density_decompress_prepare_context(const uint8_t *input_buffer, const uint_fast64_t input_size, const bool custom_dictionary, void *(*mem_alloc)(size_t)) {
-    if (input_size < sizeof(density_header))
-        return density_make_result(DENSITY_STATE_ERROR_INPUT_BUFFER_TOO_SMALL, 0, 0, NULL);
+DENSITY_WINDOWS_EXPORT density_processing_result density_compress_with_context(const uint8_t * input_buffer, const uint_fast64_t input_size, uint8_t * output_buffer, const uint_fast64_t output_size, density_context *const context) {
+    return density_compress_frame(input_buffer, input_size, output_buffer, output_size, context, 0);
+}
 
+DENSITY_WINDOWS_EXPORT density_processing_result density_decompress_prepare_context(const uint8_t *input_buffer, const uint_fast64_t input_size, const bool custom_dictionary, void *(*mem_alloc)(size_t)) {
     // Variables setup
     const uint8_t* in = input_buffer;
     if(mem_alloc == NULL)
@@ -160,41 +372,246 @@ DENSITY_WINDOWS_EXPORT density_processing_result density_decompress_prepare_cont
 
     // Read header
     density_header main_header;
-    density_header_read(&in, &main_header);
+    uint_fast64_t content_size;
+    uint_fast32_t dictionary_id;
+    const DENSITY_STATE state = density_frame_read(&in, input_size, &main_header, &content_size, &dictionary_id);
+    if(state)
+        return density_make_result(state, in - input_buffer, 0, NULL);
 
     // Setup context
-    density_context *const context = density_allocate_context(main_header.algorithm, custom_dictionary, mem_alloc);
+    density_context *const context = density_allocate_context(main_header.algorithm, main_header.hash_bits, custom_dictionary, mem_alloc);
+    if(context != NULL)
+        density_context_set_frame(context, main_header.flags, content_size, dictionary_id);
     return density_make_result(DENSITY_STATE_OK, in - input_buffer, 0, context);
 }
 
-DENSITY_WINDOWS_EXPORT density_processing_result density_decompress_with_context(const uint8_t * input_buffer, const uint_fast64_t input_size, uint8_t * output_buffer, const uint_fast64_t output_size, density_context *const context) {
+DENSITY_WINDOWS_EXPORT density_processing_result density_decompress_read_frame_header(const uint8_t *input_buffer, const uint_fast64_t input_size, density_context *const context) {
     if(context == NULL)
         return density_make_result(DENSITY_STATE_ERROR_INVALID_CONTEXT, 0, 0, context);
 
+    // Read header
+    const uint8_t* in = input_buffer;
+    density_header main_header;
+    uint_fast64_t content_size;
+    uint_fast32_t dictionary_id;
+    const DENSITY_STATE state = density_frame_read(&in, input_size, &main_header, &content_size, &dictionary_id);
+    if(state)
+        return density_make_result(state, in - input_buffer, 0, context);
+    if(main_header.algorithm != context->algorithm || main_header.hash_bits != context->hash_bits)
+        return density_make_result(DENSITY_STATE_ERROR_INVALID_CONTEXT, in - input_buffer, 0, context);
+
+    // The dictionary is left as it is, the frame may follow earlier ones
+    density_context_set_frame(context, main_header.flags, content_size, dictionary_id);
+    return density_make_result(DENSITY_STATE_OK, in - input_buffer, 0, context);
+}
+
+DENSITY_FORCE_INLINE density_processing_result density_decompress_blocks_with_context(const uint8_t *input_buffer, const uint_fast64_t input_size, uint8_t *output_buffer, const uint_fast64_t output_size, density_context *const context) {
+    if (input_size < sizeof(density_blocks_descriptor))
+        return density_make_result(DENSITY_STATE_ERROR_INPUT_BUFFER_TOO_SMALL, 0, 0, context);
+
+    // Variables setup
+    const uint8_t *in = input_buffer;
+    density_blocks_descriptor descriptor;
+    density_blocks_descriptor_read(&in, &descriptor);
+    if (descriptor.block_size < DENSITY_BLOCKS_MINIMUM_SIZE || descriptor.block_size > DENSITY_BLOCKS_MAXIMUM_SIZE)
+        return density_make_result(DENSITY_STATE_ERROR_DURING_PROCESSING, 0, 0, context);
+    const uint_fast64_t block_count = density_blocks_count(descriptor.content_size, descriptor.block_size);
+    if (block_count > (input_size - (in - input_buffer)) / sizeof(density_blocks_index_entry))
+        return density_make_result(DENSITY_STATE_ERROR_INPUT_BUFFER_TOO_SMALL, 0, 0, context);
+    if (output_size < descriptor.content_size)
+        return density_make_result(DENSITY_STATE_ERROR_OUTPUT_BUFFER_TOO_SMALL, 0, 0, context);
+    const uint8_t *index = in;
+    in += block_count * sizeof(density_blocks_index_entry);
+
+    // Blocks are independent, each one starts with a fresh dictionary
+    uint8_t *out = output_buffer;
+    density_algorithm_state state;
+    for (uint_fast64_t block = 0; block < block_count; block++) {
+        const uint_fast64_t compressed_size = density_blocks_index_read(index, block);
+        const uint_fast64_t decompressed_size = density_blocks_decompressed_size(&descriptor, block);
+        if (compressed_size > input_size - (in - input_buffer))
+            return density_make_result(DENSITY_STATE_ERROR_INPUT_BUFFER_TOO_SMALL, in - input_buffer, out - output_buffer, context);
+
+        const uint8_t *block_in = in;
+        uint8_t *block_out = out;
+        density_reset_context(context);
+        density_algorithms_prepare_state(&state, context->dictionary, context->hash_bits);
+        state.epochs = (density_algorithm_epochs *) context->dictionary_epochs;
+        state.decompressed_size = decompressed_size;
+        const density_algorithm_exit_status status = density_algorithms_decode(&state, context->algorithm, &block_in, compressed_size, &block_out, output_size - (out - output_buffer));
+        if (status)
+            return density_make_result(density_convert_algorithm_exit_status(status), in - input_buffer, out - output_buffer, context);
+        if ((uint_fast64_t) (block_out - out) != decompressed_size)
+            return density_make_result(DENSITY_STATE_ERROR_DURING_PROCESSING, in - input_buffer, out - output_buffer, context);
+
+        in += compressed_size;
+        out = block_out;
+    }
+
+    return density_make_result(DENSITY_STATE_OK, in - input_buffer, out - output_buffer, context);
+}
+
+DENSITY_WINDOWS_EXPORT DENSITY_STATE density_decompress_segment(density_algorithm_state *const DENSITY_RESTRICT state, const DENSITY_ALGORITHM algorithm, const density_segment_header *const DENSITY_RESTRICT segment, const uint8_t *input_buffer, uint8_t *output_buffer, const uint_fast64_t output_size) {
+    if (segment->decompressed_size > DENSITY_SEGMENTS_SIZE)
+        return DENSITY_STATE_ERROR_DURING_PROCESSING;
+    if (output_size < segment->decompressed_size)
+        return DENSITY_STATE_ERROR_OUTPUT_BUFFER_TOO_SMALL;
+
+    // Decoders may finish the last work blocks outside of their main loop, so copy penalty tracking restarts with every segment
+    density_algorithms_reset_copy_penalty(state);
+    state->decompressed_size = segment->decompressed_size;
+
+    const uint8_t *in = input_buffer;
+    uint8_t *out = output_buffer;
+    const density_algorithm_exit_status status = density_algorithms_decode(state, algorithm, &in, segment->compressed_size, &out, output_size);
+    if (status)
+        return density_convert_algorithm_exit_status(status);
+    if ((uint_fast64_t) (in - input_buffer) != segment->compressed_size || (uint_fast64_t) (out - output_buffer) != segment->decompressed_size)
+        return DENSITY_STATE_ERROR_DURING_PROCESSING;
+    return DENSITY_STATE_OK;
+}
+
+DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE void density_segments_prepare_state(density_context *const context, density_algorithm_state *const state, density_lion_form_data *const model) {
+    density_algorithms_prepare_state(state, context->dictionary, context->hash_bits);
+    state->epochs = (density_algorithm_epochs *) context->dictionary_epochs;
+    density_lion_form_model_init(model);
+    state->model = model;
+}
+
+DENSITY_FORCE_INLINE DENSITY_STATE density_decompress_segments_loop(density_context *const context, const uint8_t **in, const uint8_t *const in_end, uint8_t **out, uint8_t *const out_end, const bool stop_at_sync_point, uint8_t **scratch) {
+    // Variables setup
+    const uint8_t *const start = *in;
+    density_algorithm_state state;
+    density_lion_form_data model;
+    density_segment_header segment;
+
+    // Segments carry the dictionary, state and form model over to the next one, until a sync point
+    density_segments_prepare_state(context, &state, &model);
+    while (true) {
+        if ((uint_fast64_t) (in_end - *in) < sizeof(density_segment_header))
+            return DENSITY_STATE_ERROR_INPUT_BUFFER_TOO_SMALL;
+        const uint8_t *const segment_start = *in;
+        density_segment_header_read(in, &segment);
+        if (!segment.decompressed_size) {
+            if (!segment.compressed_size)
+                return DENSITY_STATE_OK;    // End marker
+            if (segment.compressed_size != DENSITY_SEGMENTS_SYNC_MARKER)
+                return DENSITY_STATE_ERROR_DURING_PROCESSING;
+            if (segment_start == start)
+                continue;   // Decoding starts at this sync point
+            if (stop_at_sync_point) {
+                *in = segment_start;
+                return DENSITY_STATE_OK;
+            }
+            density_reset_context(context);
+            density_segments_prepare_state(context, &state, &model);
+            continue;
+        }
+        if (segment.compressed_size > (uint_fast64_t) (in_end - *in))
+            return DENSITY_STATE_ERROR_INPUT_BUFFER_TOO_SMALL;
+        if (segment.decompressed_size > (uint_fast64_t) (out_end - *out))
+            return DENSITY_STATE_ERROR_OUTPUT_BUFFER_TOO_SMALL;
+
+        // Decoders may write past the end of a segment, which goes through a scratch buffer when output_buffer has no room for it
+        const bool direct = (uint_fast64_t) (out_end - *out) >= density_decompress_safe_size(segment.decompressed_size);
+        if (!direct && *scratch == NULL) {
+            *scratch = malloc(density_decompress_safe_size(DENSITY_SEGMENTS_SIZE));
+            if (*scratch == NULL)
+                return DENSITY_STATE_ERROR_DURING_PROCESSING;
+        }
+        uint8_t *const segment_out = direct ? *out : *scratch;
+        const DENSITY_STATE segment_state = density_decompress_segment(&state, context->algorithm, &segment, *in, segment_out, direct ? (uint_fast64_t) (out_end - *out) : density_decompress_safe_size(DENSITY_SEGMENTS_SIZE));
+        if (segment_state)
+            return segment_state;
+        if (!direct)
+            DENSITY_MEMCPY(*out, *scratch, segment.decompressed_size);
+        *in += segment.compressed_size;
+        *out += segment.decompressed_size;
+    }
+}
+
+DENSITY_WINDOWS_EXPORT DENSITY_STATE density_decompress_segments(density_context *const context, const uint8_t **in, const uint8_t *const in_end, uint8_t **out, uint8_t *const out_end, const bool stop_at_sync_point) {
+    uint8_t *scratch = NULL;
+    const DENSITY_STATE state = density_decompress_segments_loop(context, in, in_end, out, out_end, stop_at_sync_point, &scratch);
+    free(scratch);
+    return state;
+}
+
+DENSITY_FORCE_INLINE density_processing_result density_decompress_segments_with_context(const uint8_t *input_buffer, const uint_fast64_t input_size, uint8_t *output_buffer, const uint_fast64_t output_size, density_context *const context) {
+    const uint8_t *in = input_buffer;
+    uint8_t *out = output_buffer;
+    const DENSITY_STATE state = density_decompress_segments(context, &in, input_buffer + input_size, &out, output_buffer + output_size, false);
+    return density_make_result(state, in - input_buffer, out - output_buffer, context);
+}
+
+DENSITY_FORCE_INLINE bool density_sync_point_check(const uint8_t *in, const uint8_t *const in_end) {
+    // Literals reach the output verbatim and can hold a marker, but not the chain of segments which follows a genuine sync point
+    density_segment_header segment;
+    bool first = true;
+    while ((uint_fast64_t) (in_end - in) >= sizeof(density_segment_header)) {
+        density_segment_header_read(&in, &segment);
+        if (!segment.decompressed_size)
+            return !first && (!segment.compressed_size || segment.compressed_size == DENSITY_SEGMENTS_SYNC_MARKER);
+        if (segment.decompressed_size > DENSITY_SEGMENTS_SIZE)
+            return false;
+        if (segment.compressed_size > (uint_fast64_t) (in_end - in))
+            return !first;  // The segment right behind the sync point has to be there, later ones can be cut off with the input
+        in += segment.compressed_size;
+        first = false;
+    }
+    return !first;
+}
+
+DENSITY_WINDOWS_EXPORT uint_fast64_t density_find_sync_point(const uint8_t *input_buffer, const uint_fast64_t input_size) {
+    density_segment_header segment;
+    for (uint_fast64_t offset = 0; offset + sizeof(density_segment_header) <= input_size; offset++) {
+        const uint8_t *in = input_buffer + offset;
+        density_segment_header_read(&in, &segment);
+        if (!segment.decompressed_size && segment.compressed_size == DENSITY_SEGMENTS_SYNC_MARKER && density_sync_point_check(in, input_buffer + input_size))
+            return offset;
+    }
+    return input_size;
+}
+
+DENSITY_FORCE_INLINE density_processing_result density_decompress_run_with_context(const uint8_t * input_buffer, const uint_fast64_t input_size, uint8_t * output_buffer, const uint_fast64_t output_size, density_context *const context) {
     // Variables setup
     const uint8_t *in = input_buffer;
     uint8_t *out = output_buffer;
     density_algorithm_state state;
     density_algorithm_exit_status status = DENSITY_ALGORITHMS_EXIT_STATUS_ERROR_DURING_PROCESSING;
 
+    // A known content size rejects short output buffers up front, and frames the end of input exactly
+    if(context->header_flags & DENSITY_HEADER_FLAG_CONTENT_SIZE && output_size < context->content_size)
+        return density_make_result(DENSITY_STATE_ERROR_OUTPUT_BUFFER_TOO_SMALL, 0, 0, context);
+
     // Decompression
-    density_algorithms_prepare_state(&state, context->dictionary);
-    switch (context->algorithm) {
-        case DENSITY_ALGORITHM_CHAMELEON:
-            status = density_chameleon_decode(&state, &in, input_size, &out, output_size);
-            break;
-        case DENSITY_ALGORITHM_CHEETAH:
-            status = density_cheetah_decode(&state, &in, input_size, &out, output_size);
-            break;
-        case DENSITY_ALGORITHM_LION:
-            status = density_lion_decode(&state, &in, input_size, &out, output_size);
-            break;
-    }
+    density_context_prepare_state(context, &state);
+    if(context->header_flags & DENSITY_HEADER_FLAG_CONTENT_SIZE)
+        state.decompressed_size = context->content_size;
+    status = density_algorithms_decode(&state, context->algorithm, &in, input_size, &out, output_size);
+    if(!status && context->header_flags & DENSITY_HEADER_FLAG_CONTENT_SIZE && (uint_fast64_t) (out - output_buffer) != context->content_size)
+        return density_make_result(DENSITY_STATE_ERROR_DURING_PROCESSING, in - input_buffer, out - output_buffer, context);
 
     // Result
     return density_make_result(density_convert_algorithm_exit_status(status), in - input_buffer, out - output_buffer, context);
 }
 
+DENSITY_WINDOWS_EXPORT density_processing_result density_decompress_with_context(const uint8_t * input_buffer, const uint_fast64_t input_size, uint8_t * output_buffer, const uint_fast64_t output_size, density_context *const context) {
+    if(context == NULL)
+        return density_make_result(DENSITY_STATE_ERROR_INVALID_CONTEXT, 0, 0, context);
+    if(context->header_dictionary_id != context->dictionary_id || !(context->header_flags & DENSITY_HEADER_FLAG_STATIC_DICTIONARY) != !context->dictionary_static)
+        return density_make_result(DENSITY_STATE_ERROR_INVALID_DICTIONARY, 0, 0, context);  // Decoding needs the very dictionary the data was compressed from
+    if(context->header_flags & DENSITY_HEADER_FLAG_SEGMENTS)
+        return density_decompress_segments_with_context(input_buffer, input_size, output_buffer, output_size, context);   // Streams can be resumed at any of their sync points
+
+    const density_processing_result result = (context->header_flags & DENSITY_HEADER_FLAG_BLOCKS) ? density_decompress_blocks_with_context(input_buffer, input_size, output_buffer, output_size, context) : density_decompress_run_with_context(input_buffer, input_size, output_buffer, output_size, context);
+
+    // A frame's header only applies to that frame, unless it was rejected up front and can be retried
+    if(result.bytesRead || result.bytesWritten)
+        density_context_set_frame(context, 0, 0, 0);
+    return result;
+}
+
 DENSITY_WINDOWS_EXPORT density_processing_result density_compress(const uint8_t *input_buffer, const uint_fast64_t input_size, uint8_t *output_buffer, const uint_fast64_t output_size, const DENSITY_ALGORITHM algorithm) {
     density_processing_result result = density_compress_prepare_context(algorithm, false, malloc);
     if(result.state) {
@@ -218,3 +635,86 @@ DENSITY_WINDOWS_EXPORT density_processing_result density_decompress(const uint8_
     density_free_context(result.context, free);
     return result;
 }
+
+DENSITY_WINDOWS_EXPORT uint_fast64_t density_workspace_size(const DENSITY_ALGORITHM algorithm) {
+    return density_workspace_size_with_hash_bits(algorithm, DENSITY_HASH_BITS_DEFAULT);
+}
+
+DENSITY_WINDOWS_EXPORT uint_fast64_t density_workspace_size_with_hash_bits(const DENSITY_ALGORITHM algorithm, const uint8_t hash_bits) {
+    const size_t dictionary_size = density_get_dictionary_size_with_hash_bits(algorithm, hash_bits);
+    if(!dictionary_size)
+        return 0;
+    return DENSITY_WORKSPACE_ALIGNMENT - 1 + DENSITY_WORKSPACE_HEADER_SIZE + dictionary_size;
+}
+
+DENSITY_FORCE_INLINE density_context* density_workspace_context(const DENSITY_ALGORITHM algorithm, const uint8_t hash_bits, void *const workspace, const uint_fast64_t workspace_size, const uint_fast64_t data_size) {
+    const size_t dictionary_size = density_get_dictionary_size_with_hash_bits(algorithm, hash_bits);
+    if(workspace == NULL || !dictionary_size || workspace_size < DENSITY_WORKSPACE_ALIGNMENT - 1 + DENSITY_WORKSPACE_HEADER_SIZE + dictionary_size)
+        return NULL;
+
+    // Header at the first aligned address, dictionary right after it
+    density_workspace *const header = (density_workspace *) (((uintptr_t) workspace + DENSITY_WORKSPACE_ALIGNMENT - 1) & ~((uintptr_t) DENSITY_WORKSPACE_ALIGNMENT - 1));
+    density_context *const context = &header->context;
+    density_context_set_frame(context, 0, 0, 0);
+    context->session_open = false;
+    context->session_sequence = 0;
+    if(header->signature == DENSITY_WORKSPACE_SIGNATURE && header->address == header && context->algorithm == algorithm && context->hash_bits == hash_bits) {
+        density_reset_context_for_size(context, data_size);
+        return context;
+    }
+
+    // First use, or use with another dictionary layout
+    header->signature = DENSITY_WORKSPACE_SIGNATURE;
+    header->address = header;
+    context->algorithm = algorithm;
+    context->hash_bits = hash_bits;
+    context->dictionary_size = dictionary_size;
+    context->dictionary_type = true;
+    context->dictionary = (uint8_t *) header + DENSITY_WORKSPACE_HEADER_SIZE;
+    context->dictionary_epochs = &header->epochs;
+    context->dictionary_pages = false;
+    context->dictionary_image = NULL;
+    context->dictionary_id = 0;
+    context->dictionary_static = false;
+    context->dictionary_snapshot = NULL;
+    density_algorithms_epochs_init(&header->epochs);
+    density_reset_context_for_size(context, dictionary_size);
+    return context;
+}
+
+DENSITY_WINDOWS_EXPORT density_processing_result density_compress_with_workspace(const uint8_t *input_buffer, const uint_fast64_t input_size, uint8_t *output_buffer, const uint_fast64_t output_size, const DENSITY_ALGORITHM algorithm, void *const workspace, const uint_fast64_t workspace_size) {
+    return density_compress_with_workspace_with_hash_bits(input_buffer, input_size, output_buffer, output_size, algorithm, DENSITY_HASH_BITS_DEFAULT, workspace, workspace_size);
+}
+
+DENSITY_WINDOWS_EXPORT density_processing_result density_compress_with_workspace_with_hash_bits(const uint8_t *input_buffer, const uint_fast64_t input_size, uint8_t *output_buffer, const uint_fast64_t output_size, const DENSITY_ALGORITHM algorithm, const uint8_t hash_bits, void *const workspace, const uint_fast64_t workspace_size) {
+    if(!density_get_dictionary_size(algorithm))
+        return density_make_result(DENSITY_STATE_ERROR_INVALID_ALGORITHM, 0, 0, NULL);
+    if(hash_bits < DENSITY_HASH_BITS_MINIMUM || hash_bits > DENSITY_HASH_BITS_MAXIMUM)
+        return density_make_result(DENSITY_STATE_ERROR_INVALID_HASH_BITS, 0, 0, NULL);
+    density_context *const context = density_workspace_context(algorithm, hash_bits, workspace, workspace_size, input_size);
+    if(context == NULL)
+        return density_make_result(DENSITY_STATE_ERROR_INVALID_CONTEXT, 0, 0, NULL);
+
+    const density_processing_result result = density_compress_with_context(input_buffer, input_size, output_buffer, output_size, context);
+    return density_make_result(result.state, result.bytesRead, result.bytesWritten, NULL);
+}
+
+DENSITY_WINDOWS_EXPORT density_processing_result density_decompress_with_workspace(const uint8_t *input_buffer, const uint_fast64_t input_size, uint8_t *output_buffer, const uint_fast64_t output_size, void *const workspace, const uint_fast64_t workspace_size) {
+    // Read header
+    const uint8_t *in = input_buffer;
+    density_header main_header;
+    uint_fast64_t content_size;
+    uint_fast32_t dictionary_id;
+    const DENSITY_STATE state = density_frame_read(&in, input_size, &main_header, &content_size, &dictionary_id);
+    if(state)
+        return density_make_result(state, in - input_buffer, 0, NULL);
+
+    const uint_fast64_t data_size = main_header.flags & DENSITY_HEADER_FLAG_CONTENT_SIZE ? content_size : input_size;
+    density_context *const context = density_workspace_context((DENSITY_ALGORITHM) main_header.algorithm, main_header.hash_bits, workspace, workspace_size, data_size);
+    if(context == NULL)
+        return density_make_result(DENSITY_STATE_ERROR_INVALID_CONTEXT, in - input_buffer, 0, NULL);
+    density_context_set_frame(context, main_header.flags, content_size, dictionary_id);
+
+    const density_processing_result result = density_decompress_with_context(in, input_size - (in - input_buffer), output_buffer, output_size, context);
+    return density_make_result(result.state, result.bytesRead, result.bytesWritten, NULL);
+}
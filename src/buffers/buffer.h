@@ -38,6 +38,11 @@
 #include "../globals.h"
 #include "../density_api.h"
 #include "../structure/header.h"
+#include "../structure/blocks.h"
+#include "../structure/segments.h"
+#include "../structure/frame.h"
+#include "../algorithms/algorithms.h"
+#include "../memory/pages.h"
 #include "../algorithms/chameleon/core/chameleon_encode.h"
 #include "../algorithms/chameleon/core/chameleon_decode.h"
 #include "../algorithms/cheetah/core/cheetah_encode.h"
@@ -45,14 +50,54 @@
 #include "../algorithms/lion/core/lion_encode.h"
 #include "../algorithms/lion/core/lion_decode.h"
 
+#define DENSITY_WORKSPACE_ALIGNMENT     64
+#define DENSITY_WORKSPACE_HEADER_SIZE   ((sizeof(density_workspace) + DENSITY_WORKSPACE_ALIGNMENT - 1) & ~(DENSITY_WORKSPACE_ALIGNMENT - 1))
+#define DENSITY_WORKSPACE_SIGNATURE     0x45434150534b524fULL
+
+/*
+ * Workspaces keep their context between calls, so that dictionaries are reset lazily once prepared
+ */
+typedef struct {
+    uint64_t signature;
+    const void *address;        // Where the workspace was prepared, moved or copied ones start over
+    density_context context;
+    density_algorithm_epochs epochs;
+} density_workspace;
+
 DENSITY_WINDOWS_EXPORT uint_fast64_t density_compress_safe_size(const uint_fast64_t);
 DENSITY_WINDOWS_EXPORT uint_fast64_t density_decompress_safe_size(const uint_fast64_t);
+DENSITY_WINDOWS_EXPORT DENSITY_STATE density_get_frame_info(const uint8_t *, const uint_fast64_t, density_frame_info *const);
+DENSITY_WINDOWS_EXPORT uint_fast64_t density_metadata_frame_size(const uint_fast32_t);
+DENSITY_WINDOWS_EXPORT density_processing_result density_write_metadata_frame(const uint8_t *, const uint_fast32_t, uint8_t *, const uint_fast64_t);
+DENSITY_WINDOWS_EXPORT density_processing_result density_read_metadata_frame(const uint8_t *, const uint_fast64_t, const uint8_t **, uint_fast32_t *);
+DENSITY_WINDOWS_EXPORT DENSITY_STATE density_convert_algorithm_exit_status(const density_algorithm_exit_status);
+DENSITY_WINDOWS_EXPORT density_processing_result density_make_result(const DENSITY_STATE, const uint_fast64_t, const uint_fast64_t, density_context *const);
 DENSITY_WINDOWS_EXPORT void density_free_context(density_context *const, void (*)(void *));
+DENSITY_WINDOWS_EXPORT DENSITY_STATE density_enable_lazy_reset(density_context *const, void *(*)(size_t));
+DENSITY_WINDOWS_EXPORT DENSITY_STATE density_enable_huge_pages(density_context *const, void (*)(void *));
+DENSITY_WINDOWS_EXPORT DENSITY_STATE density_reset_context_for_size(density_context *const, const uint_fast64_t);
+DENSITY_WINDOWS_EXPORT DENSITY_STATE density_reset_context(density_context *const);
+DENSITY_WINDOWS_EXPORT DENSITY_STATE density_context_snapshot(density_context *const, void *(*)(size_t));
+DENSITY_WINDOWS_EXPORT DENSITY_STATE density_context_restore(density_context *const);
+DENSITY_WINDOWS_EXPORT void density_context_set_frame(density_context *const, const uint8_t, const uint_fast64_t, const uint_fast32_t);
 DENSITY_WINDOWS_EXPORT density_processing_result density_compress_prepare_context(const DENSITY_ALGORITHM, const bool, void *(*)(size_t));
+DENSITY_WINDOWS_EXPORT density_processing_result density_compress_prepare_context_with_hash_bits(const DENSITY_ALGORITHM, const uint8_t, const bool, void *(*)(size_t));
+DENSITY_WINDOWS_EXPORT void density_context_prepare_state(density_context *const, density_algorithm_state *const);
+DENSITY_WINDOWS_EXPORT density_processing_result density_compress_frame(const uint8_t *, const uint_fast64_t, uint8_t *, const uint_fast64_t, density_context *const, const uint8_t);
 DENSITY_WINDOWS_EXPORT density_processing_result density_compress_with_context(const uint8_t *, const uint_fast64_t, uint8_t *, const uint_fast64_t, density_context *const);
 DENSITY_WINDOWS_EXPORT density_processing_result density_compress(const uint8_t *, const uint_fast64_t, uint8_t *, const uint_fast64_t, const DENSITY_ALGORITHM);
 DENSITY_WINDOWS_EXPORT density_processing_result density_decompress_prepare_context(const uint8_t *, const uint_fast64_t, const bool, void *(*)(size_t));
+DENSITY_WINDOWS_EXPORT void density_segments_prepare_state(density_context *const, density_algorithm_state *const, density_lion_form_data *const);
+DENSITY_WINDOWS_EXPORT density_processing_result density_decompress_read_frame_header(const uint8_t *, const uint_fast64_t, density_context *const);
+DENSITY_WINDOWS_EXPORT DENSITY_STATE density_decompress_segment(density_algorithm_state *const DENSITY_RESTRICT_DECLARE, const DENSITY_ALGORITHM, const density_segment_header *const DENSITY_RESTRICT_DECLARE, const uint8_t *, uint8_t *, const uint_fast64_t);
+DENSITY_WINDOWS_EXPORT DENSITY_STATE density_decompress_segments(density_context *const, const uint8_t **, const uint8_t *const, uint8_t **, uint8_t *const, const bool);
+DENSITY_WINDOWS_EXPORT uint_fast64_t density_find_sync_point(const uint8_t *, const uint_fast64_t);
 DENSITY_WINDOWS_EXPORT density_processing_result density_decompress_with_context(const uint8_t *, const uint_fast64_t, uint8_t *, const uint_fast64_t, density_context *const);
 DENSITY_WINDOWS_EXPORT density_processing_result density_decompress(const uint8_t *, const uint_fast64_t, uint8_t *, const uint_fast64_t);
+DENSITY_WINDOWS_EXPORT uint_fast64_t density_workspace_size(const DENSITY_ALGORITHM);
+DENSITY_WINDOWS_EXPORT uint_fast64_t density_workspace_size_with_hash_bits(const DENSITY_ALGORITHM, const uint8_t);
+DENSITY_WINDOWS_EXPORT density_processing_result density_compress_with_workspace(const uint8_t *, const uint_fast64_t, uint8_t *, const uint_fast64_t, const DENSITY_ALGORITHM, void *const, const uint_fast64_t);
+DENSITY_WINDOWS_EXPORT density_processing_result density_compress_with_workspace_with_hash_bits(const uint8_t *, const uint_fast64_t, uint8_t *, const uint_fast64_t, const DENSITY_ALGORITHM, const uint8_t, void *const, const uint_fast64_t);
+DENSITY_WINDOWS_EXPORT density_processing_result density_decompress_with_workspace(const uint8_t *, const uint_fast64_t, uint8_t *, const uint_fast64_t, void *const, const uint_fast64_t);
 
 #endif
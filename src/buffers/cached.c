@@ -0,0 +1,95 @@
+/*
+ * Centaurean Density
+ *
+ * Copyright (c) 2013, Guillaume Voirin
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     1. Redistributions of source code must retain the above copyright notice, this
+ *        list of conditions and the following disclaimer.
+ *
+ *     2. Redistributions in binary form must reproduce the above copyright notice,
+ *        this list of conditions and the following disclaimer in the documentation
+ *        and/or other materials provided with the distribution.
+ *
+ *     3. Neither the name of the copyright holder nor the names of its
+ *        contributors may be used to endorse or promote products derived from
+ *        this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * 17/10/26 05:07
+ */
+
+#include "cached.h"
+
+DENSITY_THREAD_LOCAL density_context *density_cached_contexts[DENSITY_CACHED_CONTEXTS][DENSITY_CACHED_HASH_BITS];
+
+DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE density_context *density_cached_context(const DENSITY_ALGORITHM algorithm, const uint8_t hash_bits, const uint_fast64_t data_size) {
+    if (!density_get_dictionary_size_with_hash_bits(algorithm, hash_bits))
+        return NULL;
+
+    density_context **const slot = &density_cached_contexts[algorithm - 1][hash_bits - DENSITY_HASH_BITS_MINIMUM];
+    density_context *context = *slot;
+    if (context == NULL) {
+        context = density_compress_prepare_context_with_hash_bits(algorithm, hash_bits, false, malloc).context;
+        if (context == NULL || context->dictionary == NULL || density_enable_lazy_reset(context, malloc)) {
+            density_free_context(context, NULL);
+            return NULL;
+        }
+        *slot = context;
+    }
+
+    density_reset_context_for_size(context, data_size);
+    return context;
+}
+
+DENSITY_WINDOWS_EXPORT density_processing_result density_compress_cached(const uint8_t *input_buffer, const uint_fast64_t input_size, uint8_t *output_buffer, const uint_fast64_t output_size, const DENSITY_ALGORITHM algorithm) {
+    density_context *const context = density_cached_context(algorithm, DENSITY_HASH_BITS_DEFAULT, input_size);
+    if (context == NULL)
+        return density_make_result(DENSITY_STATE_ERROR_INVALID_CONTEXT, 0, 0, NULL);
+
+    const density_processing_result result = density_compress_with_context(input_buffer, input_size, output_buffer, output_size, context);
+    return density_make_result(result.state, result.bytesRead, result.bytesWritten, NULL);
+}
+
+DENSITY_WINDOWS_EXPORT density_processing_result density_decompress_cached(const uint8_t *input_buffer, const uint_fast64_t input_size, uint8_t *output_buffer, const uint_fast64_t output_size) {
+    // Read header
+    const uint8_t *in = input_buffer;
+    density_header main_header;
+    uint_fast64_t content_size;
+    uint_fast32_t dictionary_id;
+    const DENSITY_STATE state = density_frame_read(&in, input_size, &main_header, &content_size, &dictionary_id);
+    if (state)
+        return density_make_result(state, in - input_buffer, 0, NULL);
+
+    // The reset follows the amount of data going through the dictionary, the compressed size standing for it when unknown
+    const uint_fast64_t data_size = main_header.flags & DENSITY_HEADER_FLAG_CONTENT_SIZE ? content_size : input_size;
+    density_context *const context = density_cached_context((DENSITY_ALGORITHM) main_header.algorithm, main_header.hash_bits, data_size);
+    if (context == NULL)
+        return density_make_result(DENSITY_STATE_ERROR_INVALID_CONTEXT, in - input_buffer, 0, NULL);
+    density_context_set_frame(context, main_header.flags, content_size, dictionary_id);
+
+    const density_processing_result result = density_decompress_with_context(in, input_size - (in - input_buffer), output_buffer, output_size, context);
+    return density_make_result(result.state, result.bytesRead, result.bytesWritten, NULL);
+}
+
+DENSITY_WINDOWS_EXPORT void density_free_cached_contexts(void) {
+    for (uint_fast8_t algorithm = 0; algorithm < DENSITY_CACHED_CONTEXTS; algorithm++) {
+        for (uint_fast8_t width = 0; width < DENSITY_CACHED_HASH_BITS; width++) {
+            density_free_context(density_cached_contexts[algorithm][width], NULL);
+            density_cached_contexts[algorithm][width] = NULL;
+        }
+    }
+}
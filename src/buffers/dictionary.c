@@ -0,0 +1,164 @@
+/*
+ * Centaurean Density
+ *
+ * Copyright (c) 2013, Guillaume Voirin
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     1. Redistributions of source code must retain the above copyright notice, this
+ *        list of conditions and the following disclaimer.
+ *
+ *     2. Redistributions in binary form must reproduce the above copyright notice,
+ *        this list of conditions and the following disclaimer in the documentation
+ *        and/or other materials provided with the distribution.
+ *
+ *     3. Neither the name of the copyright holder nor the names of its
+ *        contributors may be used to endorse or promote products derived from
+ *        this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * 17/10/26 10:58
+ */
+
+#include "dictionary.h"
+
+DENSITY_WINDOWS_EXPORT uint_fast64_t density_dictionary_image_size(const DENSITY_ALGORITHM algorithm, const uint8_t hash_bits) {
+    if (hash_bits < DENSITY_HASH_BITS_MINIMUM || hash_bits > DENSITY_HASH_BITS_MAXIMUM || !density_get_dictionary_size(algorithm))
+        return 0;
+    return sizeof(density_dictionary_header) + density_get_dictionary_size_with_hash_bits(algorithm, hash_bits);
+}
+
+DENSITY_WINDOWS_EXPORT density_processing_result density_train_dictionary(const DENSITY_ALGORITHM algorithm, const uint8_t hash_bits, const uint8_t *const *samples, const uint_fast64_t *sample_sizes, const uint_fast64_t count, uint8_t *image, const uint_fast64_t image_size) {
+    if (!density_get_dictionary_size(algorithm))
+        return density_make_result(DENSITY_STATE_ERROR_INVALID_ALGORITHM, 0, 0, NULL);
+    if (hash_bits < DENSITY_HASH_BITS_MINIMUM || hash_bits > DENSITY_HASH_BITS_MAXIMUM)
+        return density_make_result(DENSITY_STATE_ERROR_INVALID_HASH_BITS, 0, 0, NULL);
+    if (image_size < density_dictionary_image_size(algorithm, hash_bits))
+        return density_make_result(DENSITY_STATE_ERROR_OUTPUT_BUFFER_TOO_SMALL, 0, 0, NULL);
+
+    // Variables setup
+    const size_t dictionary_size = density_get_dictionary_size_with_hash_bits(algorithm, hash_bits);
+    uint_fast64_t longest_sample = 0;
+    for (uint_fast64_t sample = 0; sample < count; sample++)
+        longest_sample = DENSITY_MAX_2(longest_sample, sample_sizes[sample]);
+    void *const dictionary = malloc(dictionary_size);
+    uint8_t *const scratch = malloc(density_compress_safe_size(longest_sample));
+    if (dictionary == NULL || scratch == NULL) {
+        free(dictionary);
+        free(scratch);
+        return density_make_result(DENSITY_STATE_ERROR_DURING_PROCESSING, 0, 0, NULL);
+    }
+    DENSITY_MEMSET(dictionary, 0, dictionary_size);
+
+    // Samples are encoded one after the other without reset, so that later samples take precedence on hash collisions
+    uint_fast64_t read = 0;
+    density_algorithm_state state;
+    for (uint_fast64_t sample = 0; sample < count; sample++) {
+        const uint8_t *in = samples[sample];
+        uint8_t *out = scratch;
+        density_algorithms_prepare_state(&state, dictionary, hash_bits);
+        const density_algorithm_exit_status status = density_algorithms_encode(&state, algorithm, &in, sample_sizes[sample], &out, density_compress_safe_size(longest_sample));
+        if (status) {
+            free(dictionary);
+            free(scratch);
+            return density_make_result(density_convert_algorithm_exit_status(status), read, 0, NULL);
+        }
+        read += sample_sizes[sample];
+    }
+
+    // Image
+    uint8_t *out = image;
+    density_dictionary_header_write(&out, algorithm, hash_bits, density_dictionary_checksum(algorithm, hash_bits, (const uint8_t *) dictionary, dictionary_size), (uint_fast32_t) dictionary_size);
+    DENSITY_MEMCPY(out, dictionary, dictionary_size);
+    out += dictionary_size;
+
+    free(dictionary);
+    free(scratch);
+    return density_make_result(DENSITY_STATE_OK, read, out - image, NULL);
+}
+
+DENSITY_WINDOWS_EXPORT uint_fast32_t density_dictionary_id(const uint8_t *image, const uint_fast64_t image_size) {
+    if (image == NULL || image_size < sizeof(density_dictionary_header))
+        return 0;
+
+    const uint8_t *in = image;
+    density_dictionary_header header;
+    density_dictionary_header_read(&in, &header);
+    if (header.magic != DENSITY_DICTIONARY_MAGIC)
+        return 0;
+    return header.id;
+}
+
+DENSITY_FORCE_INLINE const uint8_t *density_dictionary_image_content(const density_context *const context, const uint8_t *image, const uint_fast64_t image_size, uint_fast32_t *const id) {
+    if (image_size < sizeof(density_dictionary_header))
+        return NULL;
+    const uint8_t *in = image;
+    density_dictionary_header header;
+    density_dictionary_header_read(&in, &header);
+    if (header.magic != DENSITY_DICTIONARY_MAGIC || header.format_version != DENSITY_DICTIONARY_FORMAT_VERSION || header.byte_order != DENSITY_DICTIONARY_BYTE_ORDER)
+        return NULL;
+    if (header.algorithm != context->algorithm || header.hash_bits != context->hash_bits || header.size != density_get_dictionary_size_with_hash_bits(context->algorithm, context->hash_bits))
+        return NULL;
+    if (image_size - sizeof(density_dictionary_header) < header.size || density_dictionary_checksum(context->algorithm, context->hash_bits, in, header.size) != header.id)
+        return NULL;
+    *id = header.id;
+    return in;
+}
+
+DENSITY_WINDOWS_EXPORT DENSITY_STATE density_load_dictionary(density_context *const context, const uint8_t *image, const uint_fast64_t image_size) {
+    if (context == NULL || context->dictionary == NULL)
+        return DENSITY_STATE_ERROR_INVALID_CONTEXT;     // The image is copied into the context's own dictionary
+
+    // No image unloads the current one
+    if (image == NULL) {
+        context->dictionary_image = NULL;
+        context->dictionary_id = 0;
+        context->dictionary_static = false;
+        density_reset_context(context);
+        return DENSITY_STATE_OK;
+    }
+
+    // Check image
+    uint_fast32_t id;
+    const uint8_t *const content = density_dictionary_image_content(context, image, image_size, &id);
+    if (content == NULL)
+        return DENSITY_STATE_ERROR_INVALID_DICTIONARY;
+
+    // Resets copy the image back into the dictionary from now on
+    context->dictionary_image = content;
+    context->dictionary_id = id;
+    context->dictionary_static = false;
+    density_reset_context(context);
+    return DENSITY_STATE_OK;
+}
+
+DENSITY_WINDOWS_EXPORT DENSITY_STATE density_load_static_dictionary(density_context *const context, const uint8_t *image, const uint_fast64_t image_size) {
+    if (context == NULL)
+        return DENSITY_STATE_ERROR_INVALID_CONTEXT;
+    if (image == NULL)
+        return density_load_dictionary(context, NULL, 0);
+
+    // Check image, whose entries are read in place
+    uint_fast32_t id;
+    const uint8_t *const content = density_dictionary_image_content(context, image, image_size, &id);
+    if (content == NULL || (uintptr_t) content & (sizeof(uint32_t) - 1))
+        return DENSITY_STATE_ERROR_INVALID_DICTIONARY;
+
+    // The image is used as is, the context's own dictionary is left untouched
+    context->dictionary_image = content;
+    context->dictionary_id = id;
+    context->dictionary_static = true;
+    return DENSITY_STATE_OK;
+}
@@ -0,0 +1,50 @@
+/*
+ * Centaurean Density
+ *
+ * Copyright (c) 2013, Guillaume Voirin
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     1. Redistributions of source code must retain the above copyright notice, this
+ *        list of conditions and the following disclaimer.
+ *
+ *     2. Redistributions in binary form must reproduce the above copyright notice,
+ *        this list of conditions and the following disclaimer in the documentation
+ *        and/or other materials provided with the distribution.
+ *
+ *     3. Neither the name of the copyright holder nor the names of its
+ *        contributors may be used to endorse or promote products derived from
+ *        this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * 17/10/26 10:58
+ */
+
+#ifndef DENSITY_DICTIONARY_H
+#define DENSITY_DICTIONARY_H
+
+#include "../globals.h"
+#include "../density_api.h"
+#include "../structure/dictionary_image.h"
+#include "../algorithms/algorithms.h"
+#include "buffer.h"
+
+DENSITY_WINDOWS_EXPORT uint_fast64_t density_dictionary_image_size(const DENSITY_ALGORITHM, const uint8_t);
+DENSITY_WINDOWS_EXPORT density_processing_result density_train_dictionary(const DENSITY_ALGORITHM, const uint8_t, const uint8_t *const *, const uint_fast64_t *, const uint_fast64_t, uint8_t *, const uint_fast64_t);
+DENSITY_WINDOWS_EXPORT uint_fast32_t density_dictionary_id(const uint8_t *, const uint_fast64_t);
+DENSITY_WINDOWS_EXPORT DENSITY_STATE density_load_dictionary(density_context *const, const uint8_t *, const uint_fast64_t);
+DENSITY_WINDOWS_EXPORT DENSITY_STATE density_load_static_dictionary(density_context *const, const uint8_t *, const uint_fast64_t);
+
+#endif
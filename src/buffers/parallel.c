@@ -0,0 +1,537 @@
+/*
+ * Centaurean Density
+ *
+ * Copyright (c) 2013, Guillaume Voirin
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     1. Redistributions of source code must retain the above copyright notice, this
+ *        list of conditions and the following disclaimer.
+ *
+ *     2. Redistributions in binary form must reproduce the above copyright notice,
+ *        this list of conditions and the following disclaimer in the documentation
+ *        and/or other materials provided with the distribution.
+ *
+ *     3. Neither the name of the copyright holder nor the names of its
+ *        contributors may be used to endorse or promote products derived from
+ *        this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * 17/10/26 04:06
+ */
+
+#include "parallel.h"
+
+DENSITY_FORCE_INLINE uint_fast32_t density_parallel_block_size(const uint_fast32_t requested_block_size) {
+    if (!requested_block_size)
+        return DENSITY_BLOCKS_DEFAULT_SIZE;
+    if (requested_block_size < DENSITY_BLOCKS_MINIMUM_SIZE)
+        return DENSITY_BLOCKS_MINIMUM_SIZE;
+    if (requested_block_size > DENSITY_BLOCKS_MAXIMUM_SIZE)
+        return DENSITY_BLOCKS_MAXIMUM_SIZE;
+    return requested_block_size;
+}
+
+DENSITY_FORCE_INLINE uint_fast16_t density_parallel_threads(const uint_fast16_t requested_threads, const uint_fast64_t block_count) {
+    uint_fast64_t threads = requested_threads ? requested_threads : density_threads_available();
+    if (threads > DENSITY_THREADS_MAXIMUM)
+        threads = DENSITY_THREADS_MAXIMUM;
+    if (threads > block_count)
+        threads = block_count;
+    return (uint_fast16_t) (threads ? threads : 1);
+}
+
+DENSITY_FORCE_INLINE density_context *density_parallel_prepare_context(const DENSITY_ALGORITHM algorithm, const uint8_t hash_bits, const uint_fast32_t block_size) {
+    density_context *const context = density_compress_prepare_context_with_hash_bits(algorithm, hash_bits, false, malloc).context;
+    if (context == NULL || context->dictionary == NULL) {
+        density_free_context(context, NULL);
+        return NULL;
+    }
+
+    // Small blocks would spend most of their time zeroing the dictionary, lazy reset only clears what they use
+    if (block_size <= context->dictionary_size)
+        density_enable_lazy_reset(context, malloc);
+    return context;
+}
+
+DENSITY_FORCE_INLINE uint_fast64_t density_parallel_middle_block(const density_parallel_worker *const worker) {
+    return worker->first_block + (worker->end_block - worker->first_block + 1) / 2;
+}
+
+DENSITY_FORCE_INLINE uint_fast64_t density_parallel_output_stride(const uint_fast64_t input_size, const uint_fast32_t block_size) {
+    return density_compress_safe_size(input_size < block_size ? input_size : block_size);
+}
+
+DENSITY_WINDOWS_EXPORT uint_fast64_t density_compress_parallel_safe_size(const uint_fast64_t input_size, const uint_fast32_t requested_block_size) {
+    const uint_fast32_t block_size = density_parallel_block_size(requested_block_size);
+    const uint_fast64_t block_count = density_blocks_count(input_size, block_size);
+
+    uint_fast64_t longest_output_size = 0;
+    longest_output_size += sizeof(density_header);
+    longest_output_size += sizeof(density_blocks_descriptor);
+    longest_output_size += sizeof(density_blocks_index_entry) * block_count;                               // Block index
+    longest_output_size += density_parallel_output_stride(input_size, block_size) * block_count;            // Every block staged at its worst case offset
+
+    return longest_output_size;
+}
+
+DENSITY_FORCE_INLINE uint8_t *density_compress_parallel_lane_end(const density_parallel_worker *const worker, const uint_fast64_t end_block) {
+    // Lanes are staged at their worst case offset, up to the next one, and the frame's last lane may use whatever output is left
+    return end_block == worker->block_count ? worker->output_end : worker->output_buffer + end_block * worker->output_stride;
+}
+
+DENSITY_FORCE_INLINE density_algorithm_exit_status density_compress_parallel_block(density_parallel_worker *const worker, const uint_fast64_t block, uint8_t **out, uint8_t *const out_end) {
+    density_algorithm_state state;
+    const uint8_t *in = worker->input_buffer + block * worker->descriptor.block_size;
+    uint8_t *const block_start = *out;
+
+    density_reset_context(worker->context);
+    density_algorithms_prepare_state(&state, worker->context->dictionary, worker->context->hash_bits);
+    state.epochs = (density_algorithm_epochs *) worker->context->dictionary_epochs;
+    const density_algorithm_exit_status status = density_algorithms_encode(&state, worker->algorithm, &in, density_blocks_decompressed_size(&worker->descriptor, block), out, (uint_fast64_t) (out_end - *out));
+    if (status)
+        return status;
+
+    density_blocks_index_write(worker->index, block, (uint_fast32_t) (*out - block_start));
+    return DENSITY_ALGORITHMS_EXIT_STATUS_FINISHED;
+}
+
+DENSITY_FORCE_INLINE density_algorithm_exit_status density_compress_parallel_block_pairs(density_parallel_worker *const worker) {
+    density_algorithm_state state_a;
+    density_algorithm_state state_b;
+    density_algorithm_state *const states[2] = {&state_a, &state_b};
+    density_context *const contexts[2] = {worker->context, worker->pair_context};
+
+    // The run is split in two lanes encoded in lockstep with a dictionary each, the first one taking the odd block if any
+    const uint_fast64_t middle_block = density_parallel_middle_block(worker);
+    const uint_fast64_t first_blocks[2] = {worker->first_block, middle_block};
+    uint8_t *const out_ends[2] = {density_compress_parallel_lane_end(worker, middle_block), density_compress_parallel_lane_end(worker, worker->end_block)};
+    uint8_t *out[2] = {worker->output_buffer + worker->first_block * worker->output_stride, worker->output_buffer + middle_block * worker->output_stride};
+    for (uint_fast64_t offset = 0; middle_block + offset < worker->end_block; offset++) {
+        const uint8_t *in[2];
+        uint_fast64_t in_size[2];
+        uint_fast64_t out_size[2];
+        uint8_t *block_starts[2];
+        for (uint_fast8_t lane = 0; lane < 2; lane++) {
+            const uint_fast64_t block = first_blocks[lane] + offset;
+            in[lane] = worker->input_buffer + block * worker->descriptor.block_size;
+            in_size[lane] = density_blocks_decompressed_size(&worker->descriptor, block);
+            out_size[lane] = (uint_fast64_t) (out_ends[lane] - out[lane]);
+            block_starts[lane] = out[lane];
+            density_reset_context(contexts[lane]);
+            density_algorithms_prepare_state(states[lane], contexts[lane]->dictionary, contexts[lane]->hash_bits);
+            states[lane]->epochs = (density_algorithm_epochs *) contexts[lane]->dictionary_epochs;
+        }
+        const density_algorithm_exit_status status = density_algorithms_encode_pair(states, worker->algorithm, in, in_size, out, out_size);
+        if (status)
+            return status;
+
+        for (uint_fast8_t lane = 0; lane < 2; lane++)
+            density_blocks_index_write(worker->index, first_blocks[lane] + offset, (uint_fast32_t) (out[lane] - block_starts[lane]));
+    }
+
+    if (middle_block - worker->first_block > worker->end_block - middle_block)
+        return density_compress_parallel_block(worker, middle_block - 1, &out[0], out_ends[0]);
+    return DENSITY_ALGORITHMS_EXIT_STATUS_FINISHED;
+}
+
+DENSITY_FORCE_INLINE density_algorithm_exit_status density_compress_parallel_blocks(density_parallel_worker *const worker) {
+    if (worker->pair_context != NULL)
+        return density_compress_parallel_block_pairs(worker);
+
+    // Blocks of the run follow each other, so that a single thread writes its frame in place
+    uint8_t *out = worker->output_buffer + worker->first_block * worker->output_stride;
+    uint8_t *const out_end = density_compress_parallel_lane_end(worker, worker->end_block);
+    for (uint_fast64_t block = worker->first_block; block < worker->end_block; block++) {
+        const density_algorithm_exit_status status = density_compress_parallel_block(worker, block, &out, out_end);
+        if (status)
+            return status;
+    }
+    return DENSITY_ALGORITHMS_EXIT_STATUS_FINISHED;
+}
+
+DENSITY_THREAD_FUNCTION(density_compress_parallel_worker, argument) {
+    density_parallel_worker *const worker = (density_parallel_worker *) argument;
+    worker->status = density_compress_parallel_blocks(worker);
+    DENSITY_THREAD_EXIT;
+}
+
+DENSITY_FORCE_INLINE void density_parallel_run(density_parallel_worker *const workers, const uint_fast16_t threads, density_thread_function function, density_algorithm_exit_status (*inline_function)(density_parallel_worker *const)) {
+    density_thread handles[DENSITY_THREADS_MAXIMUM];
+    bool started[DENSITY_THREADS_MAXIMUM];
+
+    // The calling thread processes the first worker's share, and any share whose thread could not be created
+    for (uint_fast16_t id = 1; id < threads; id++)
+        started[id] = density_thread_create(&handles[id], function, &workers[id]);
+    workers[0].status = inline_function(&workers[0]);
+    for (uint_fast16_t id = 1; id < threads; id++) {
+        if (started[id])
+            density_thread_join(handles[id]);
+        else
+            workers[id].status = inline_function(&workers[id]);
+    }
+}
+
+DENSITY_FORCE_INLINE void density_compress_parallel_free_contexts(density_parallel_worker *const workers, const uint_fast16_t threads) {
+    for (uint_fast16_t id = 0; id < threads; id++) {
+        density_free_context(workers[id].context, NULL);
+        density_free_context(workers[id].pair_context, NULL);
+    }
+}
+
+DENSITY_WINDOWS_EXPORT density_processing_result density_compress_parallel(const uint8_t *input_buffer, const uint_fast64_t input_size, uint8_t *output_buffer, const uint_fast64_t output_size, const DENSITY_ALGORITHM algorithm, const uint_fast32_t requested_block_size, const uint_fast16_t requested_threads) {
+    return density_compress_parallel_with_hash_bits(input_buffer, input_size, output_buffer, output_size, algorithm, DENSITY_HASH_BITS_DEFAULT, requested_block_size, requested_threads);
+}
+
+DENSITY_WINDOWS_EXPORT density_processing_result density_compress_parallel_with_hash_bits(const uint8_t *input_buffer, const uint_fast64_t input_size, uint8_t *output_buffer, const uint_fast64_t output_size, const DENSITY_ALGORITHM algorithm, const uint8_t hash_bits, const uint_fast32_t requested_block_size, const uint_fast16_t requested_threads) {
+    if (!density_get_dictionary_size(algorithm))
+        return density_make_result(DENSITY_STATE_ERROR_INVALID_ALGORITHM, 0, 0, NULL);
+    if (hash_bits < DENSITY_HASH_BITS_MINIMUM || hash_bits > DENSITY_HASH_BITS_MAXIMUM)
+        return density_make_result(DENSITY_STATE_ERROR_INVALID_HASH_BITS, 0, 0, NULL);
+    const uint_fast32_t block_size = density_parallel_block_size(requested_block_size);
+    const uint_fast64_t block_count = density_blocks_count(input_size, block_size);
+    if (output_size < sizeof(density_header) + sizeof(density_blocks_descriptor) + sizeof(density_blocks_index_entry) * block_count)
+        return density_make_result(DENSITY_STATE_ERROR_OUTPUT_BUFFER_TOO_SMALL, 0, 0, NULL);
+
+    // Frame
+    uint8_t *out = output_buffer;
+    density_header_write(&out, algorithm, DENSITY_HEADER_FLAG_BLOCKS, hash_bits);
+    density_blocks_descriptor_write(&out, input_size, block_size);
+    uint8_t *const index = out;
+    out += sizeof(density_blocks_index_entry) * block_count;
+
+    // Workers setup, every lane of blocks being staged at its worst case offset
+    const uint_fast16_t threads = density_parallel_threads(requested_threads, block_count);
+    const uint_fast64_t output_stride = density_parallel_output_stride(input_size, block_size);
+    density_parallel_worker workers[DENSITY_THREADS_MAXIMUM];
+    uint_fast64_t lanes[2 * DENSITY_THREADS_MAXIMUM + 1];
+    uint_fast32_t lane_count = 0;
+    for (uint_fast16_t id = 0; id < threads; id++) {
+        density_parallel_worker *const worker = &workers[id];
+        worker->input_buffer = input_buffer;
+        worker->output_buffer = out;
+        worker->output_end = output_buffer + output_size;
+        worker->output_stride = output_stride;
+        worker->index = index;
+        worker->input_offsets = NULL;
+        worker->output_offsets = NULL;
+        worker->descriptor.content_size = input_size;
+        worker->descriptor.block_size = block_size;
+        worker->descriptor.reserved = 0;
+        worker->block_count = block_count;
+        worker->algorithm = algorithm;
+        worker->context = density_parallel_prepare_context(worker->algorithm, hash_bits, block_size);
+        worker->pair_context = NULL;
+        worker->first_block = block_count * id / threads;   // Contiguous runs
+        worker->block_step = 1;
+        worker->end_block = block_count * (id + 1) / threads;
+        worker->status = DENSITY_ALGORITHMS_EXIT_STATUS_ERROR_DURING_PROCESSING;
+        if (worker->context == NULL) {
+            density_compress_parallel_free_contexts(workers, id);
+            return density_make_result(DENSITY_STATE_ERROR_DURING_PROCESSING, 0, 0, NULL);
+        }
+
+        // Workers with several blocks to go encode them by pairs when the kernel allows it, without it being required
+        if (density_algorithms_encode_pair_available(algorithm) && worker->end_block - worker->first_block > 1)
+            worker->pair_context = density_parallel_prepare_context(worker->algorithm, hash_bits, block_size);
+        lanes[lane_count++] = worker->first_block;
+        if (worker->pair_context != NULL)
+            lanes[lane_count++] = density_parallel_middle_block(worker);
+    }
+    lanes[lane_count] = block_count;
+    if (lanes[lane_count - 1] * output_stride > (uint_fast64_t) (output_buffer + output_size - out)) {
+        density_compress_parallel_free_contexts(workers, threads);
+        return density_make_result(DENSITY_STATE_ERROR_OUTPUT_BUFFER_TOO_SMALL, 0, 0, NULL);
+    }
+
+    // Compression
+    density_parallel_run(workers, threads, density_compress_parallel_worker, density_compress_parallel_blocks);
+    density_algorithm_exit_status status = DENSITY_ALGORITHMS_EXIT_STATUS_FINISHED;
+    for (uint_fast16_t id = 0; id < threads; id++) {
+        if (workers[id].status)
+            status = workers[id].status;
+    }
+    density_compress_parallel_free_contexts(workers, threads);
+    if (status)
+        return density_make_result(density_convert_algorithm_exit_status(status), 0, 0, NULL);
+
+    // Lanes are packed behind the index, the first one being in place already
+    uint8_t *const staging = out;
+    for (uint_fast32_t lane = 0; lane < lane_count; lane++) {
+        uint_fast64_t lane_size = 0;
+        for (uint_fast64_t block = lanes[lane]; block < lanes[lane + 1]; block++)
+            lane_size += density_blocks_index_read(index, block);
+        if (out != staging + lanes[lane] * output_stride)
+            DENSITY_MEMMOVE(out, staging + lanes[lane] * output_stride, lane_size);
+        out += lane_size;
+    }
+
+    return density_make_result(DENSITY_STATE_OK, input_size, out - output_buffer, NULL);
+}
+
+DENSITY_FORCE_INLINE density_algorithm_exit_status density_decompress_parallel_block(density_parallel_worker *const worker, const uint_fast64_t block) {
+    density_algorithm_state state;
+    const uint8_t *in = worker->input_buffer + worker->input_offsets[block];
+    const uint8_t *const in_end = worker->input_buffer + worker->input_offsets[block + 1];
+    uint8_t *const block_start = worker->output_buffer + block * worker->descriptor.block_size;
+    uint8_t *out = block_start;
+    const uint_fast64_t decompressed_size = density_blocks_decompressed_size(&worker->descriptor, block);
+
+    density_reset_context(worker->context);
+    density_algorithms_prepare_state(&state, worker->context->dictionary, worker->context->hash_bits);
+    state.epochs = (density_algorithm_epochs *) worker->context->dictionary_epochs;
+    state.decompressed_size = decompressed_size;
+
+    // Output is bounded by the block's end, decoders stall before a last unit which would need more room and finish it in a small buffer
+    density_algorithm_exit_status status = density_algorithms_decode(&state, worker->algorithm, &in, (uint_fast64_t) (in_end - in), &out, decompressed_size);
+    if (status == DENSITY_ALGORITHMS_EXIT_STATUS_OUTPUT_STALL) {
+        uint8_t tail[DENSITY_PARALLEL_TAIL_SIZE];
+        uint8_t *tail_out = tail;
+        status = density_algorithms_decode(&state, worker->algorithm, &in, (uint_fast64_t) (in_end - in), &tail_out, DENSITY_PARALLEL_TAIL_SIZE);
+        if (!status) {
+            if ((uint_fast64_t) (tail_out - tail) != decompressed_size - (uint_fast64_t) (out - block_start))
+                return DENSITY_ALGORITHMS_EXIT_STATUS_ERROR_DURING_PROCESSING;
+            DENSITY_MEMCPY(out, tail, (size_t) (tail_out - tail));
+            out += tail_out - tail;
+        }
+    }
+    if (status)
+        return status;
+    if ((uint_fast64_t) (out - block_start) != decompressed_size)
+        return DENSITY_ALGORITHMS_EXIT_STATUS_ERROR_DURING_PROCESSING;
+    return DENSITY_ALGORITHMS_EXIT_STATUS_FINISHED;
+}
+
+DENSITY_FORCE_INLINE density_algorithm_exit_status density_decompress_parallel_blocks(density_parallel_worker *const worker) {
+    for (uint_fast64_t block = worker->first_block; block < worker->end_block; block++) {
+        const density_algorithm_exit_status status = density_decompress_parallel_block(worker, block);
+        if (status)
+            return status;
+    }
+    return DENSITY_ALGORITHMS_EXIT_STATUS_FINISHED;
+}
+
+DENSITY_THREAD_FUNCTION(density_decompress_parallel_worker, argument) {
+    density_parallel_worker *const worker = (density_parallel_worker *) argument;
+    worker->status = density_decompress_parallel_blocks(worker);
+    DENSITY_THREAD_EXIT;
+}
+
+DENSITY_FORCE_INLINE density_algorithm_exit_status density_decompress_parallel_segments(density_parallel_worker *const worker) {
+    // Here blocks are the runs of segments between sync points
+    for (uint_fast64_t run = worker->first_block; run < worker->block_count; run += worker->block_step) {
+        const uint8_t *in = worker->input_buffer + worker->input_offsets[run];
+        uint8_t *out = worker->output_buffer + worker->output_offsets[run];
+        uint8_t *const run_end = worker->output_buffer + worker->output_offsets[run + 1];
+
+        density_reset_context(worker->context);
+        if (density_decompress_segments(worker->context, &in, worker->input_buffer + worker->input_offsets[worker->block_count], &out, run_end, true) || out != run_end)
+            return DENSITY_ALGORITHMS_EXIT_STATUS_ERROR_DURING_PROCESSING;
+    }
+    return DENSITY_ALGORITHMS_EXIT_STATUS_FINISHED;
+}
+
+DENSITY_THREAD_FUNCTION(density_decompress_parallel_segments_worker, argument) {
+    density_parallel_worker *const worker = (density_parallel_worker *) argument;
+    worker->status = density_decompress_parallel_segments(worker);
+    DENSITY_THREAD_EXIT;
+}
+
+DENSITY_FORCE_INLINE density_processing_result density_decompress_parallel_segments_frame(const uint8_t *input_buffer, const uint_fast64_t input_size, const uint8_t *in, uint8_t *output_buffer, const uint_fast64_t output_size, const density_header *const main_header, const uint_fast16_t requested_threads) {
+    // Runs between sync points are located by walking the segment headers, twice : to count them, then to record them
+    uint_fast64_t run_count = 1;
+    uint_fast64_t content_size = 0;
+    density_segment_header segment;
+    const uint8_t *position = in;
+    while (true) {
+        if ((uint_fast64_t) (input_buffer + input_size - position) < sizeof(density_segment_header))
+            return density_make_result(DENSITY_STATE_ERROR_INPUT_BUFFER_TOO_SMALL, in - input_buffer, 0, NULL);
+        const uint8_t *const segment_start = position;
+        density_segment_header_read(&position, &segment);
+        if (!segment.decompressed_size) {
+            if (!segment.compressed_size)
+                break;  // End marker
+            if (segment.compressed_size != DENSITY_SEGMENTS_SYNC_MARKER)
+                return density_make_result(DENSITY_STATE_ERROR_DURING_PROCESSING, in - input_buffer, 0, NULL);
+            if (segment_start != in)
+                run_count++;
+            continue;
+        }
+        if (segment.compressed_size > (uint_fast64_t) (input_buffer + input_size - position))
+            return density_make_result(DENSITY_STATE_ERROR_INPUT_BUFFER_TOO_SMALL, in - input_buffer, 0, NULL);
+        position += segment.compressed_size;
+        content_size += segment.decompressed_size;
+    }
+    if (run_count == 1)
+        return density_decompress(input_buffer, input_size, output_buffer, output_size);
+    if (output_size < density_decompress_safe_size(content_size))
+        return density_make_result(DENSITY_STATE_ERROR_OUTPUT_BUFFER_TOO_SMALL, in - input_buffer, 0, NULL);
+
+    uint_fast64_t *input_offsets = malloc(sizeof(uint_fast64_t) * 2 * (run_count + 1));
+    if (input_offsets == NULL)
+        return density_make_result(DENSITY_STATE_ERROR_DURING_PROCESSING, in - input_buffer, 0, NULL);
+    uint_fast64_t *const output_offsets = input_offsets + run_count + 1;
+    uint_fast64_t run = 0;
+    uint_fast64_t output_offset = 0;
+    input_offsets[0] = (uint_fast64_t) (in - input_buffer);
+    output_offsets[0] = 0;
+    for (position = in;;) {
+        const uint8_t *const segment_start = position;
+        density_segment_header_read(&position, &segment);
+        if (!segment.decompressed_size) {
+            if (!segment.compressed_size)
+                break;
+            if (segment_start != in) {
+                input_offsets[++run] = (uint_fast64_t) (segment_start - input_buffer);
+                output_offsets[run] = output_offset;
+            }
+            continue;
+        }
+        position += segment.compressed_size;
+        output_offset += segment.decompressed_size;
+    }
+    input_offsets[run_count] = (uint_fast64_t) (position - input_buffer);
+    output_offsets[run_count] = content_size;
+
+    // Workers setup
+    const uint_fast64_t average_run_size = content_size / run_count;
+    const uint_fast16_t threads = density_parallel_threads(requested_threads, run_count);
+    density_parallel_worker workers[DENSITY_THREADS_MAXIMUM];
+    for (uint_fast16_t id = 0; id < threads; id++) {
+        density_parallel_worker *const worker = &workers[id];
+        worker->input_buffer = input_buffer;
+        worker->output_buffer = output_buffer;
+        worker->output_end = output_buffer + output_size;
+        worker->output_stride = 0;
+        worker->index = NULL;
+        worker->input_offsets = input_offsets;
+        worker->output_offsets = output_offsets;
+        worker->block_count = run_count;
+        worker->algorithm = (DENSITY_ALGORITHM) main_header->algorithm;
+        worker->context = density_parallel_prepare_context(worker->algorithm, main_header->hash_bits, (uint_fast32_t) (average_run_size < DENSITY_BLOCKS_MAXIMUM_SIZE ? average_run_size : DENSITY_BLOCKS_MAXIMUM_SIZE));
+        worker->pair_context = NULL;
+        worker->first_block = id;
+        worker->block_step = threads;
+        worker->end_block = run_count;
+        worker->status = DENSITY_ALGORITHMS_EXIT_STATUS_ERROR_DURING_PROCESSING;
+        if (worker->context == NULL) {
+            for (uint_fast16_t allocated = 0; allocated < id; allocated++)
+                density_free_context(workers[allocated].context, NULL);
+            free(input_offsets);
+            return density_make_result(DENSITY_STATE_ERROR_DURING_PROCESSING, in - input_buffer, 0, NULL);
+        }
+    }
+
+    // Decompression, every run straight into its final position
+    density_parallel_run(workers, threads, density_decompress_parallel_segments_worker, density_decompress_parallel_segments);
+    density_algorithm_exit_status status = DENSITY_ALGORITHMS_EXIT_STATUS_FINISHED;
+    for (uint_fast16_t id = 0; id < threads; id++) {
+        if (workers[id].status)
+            status = workers[id].status;
+        density_free_context(workers[id].context, NULL);
+    }
+    const uint_fast64_t read = input_offsets[run_count];
+    free(input_offsets);
+    if (status)
+        return density_make_result(density_convert_algorithm_exit_status(status), in - input_buffer, 0, NULL);
+
+    return density_make_result(DENSITY_STATE_OK, read, content_size, NULL);
+}
+
+DENSITY_WINDOWS_EXPORT density_processing_result density_decompress_parallel(const uint8_t *input_buffer, const uint_fast64_t input_size, uint8_t *output_buffer, const uint_fast64_t output_size, const uint_fast16_t requested_threads) {
+    // Read header
+    const uint8_t *in = input_buffer;
+    density_header main_header;
+    uint_fast64_t content_size;
+    uint_fast32_t dictionary_id;
+    const DENSITY_STATE state = density_frame_read(&in, input_size, &main_header, &content_size, &dictionary_id);
+    if (state)
+        return density_make_result(state, in - input_buffer, 0, NULL);
+    if (main_header.flags & DENSITY_HEADER_FLAG_SEGMENTS)
+        return density_decompress_parallel_segments_frame(input_buffer, input_size, in, output_buffer, output_size, &main_header, requested_threads);
+    if (!(main_header.flags & DENSITY_HEADER_FLAG_BLOCKS))
+        return density_decompress(input_buffer, input_size, output_buffer, output_size);
+
+    // Read frame
+    if (input_size - (in - input_buffer) < sizeof(density_blocks_descriptor))
+        return density_make_result(DENSITY_STATE_ERROR_INPUT_BUFFER_TOO_SMALL, in - input_buffer, 0, NULL);
+    density_blocks_descriptor descriptor;
+    density_blocks_descriptor_read(&in, &descriptor);
+    if (descriptor.block_size < DENSITY_BLOCKS_MINIMUM_SIZE || descriptor.block_size > DENSITY_BLOCKS_MAXIMUM_SIZE)
+        return density_make_result(DENSITY_STATE_ERROR_DURING_PROCESSING, in - input_buffer, 0, NULL);
+    const uint_fast64_t block_count = density_blocks_count(descriptor.content_size, descriptor.block_size);
+    if (block_count > (input_size - (in - input_buffer)) / sizeof(density_blocks_index_entry))
+        return density_make_result(DENSITY_STATE_ERROR_INPUT_BUFFER_TOO_SMALL, in - input_buffer, 0, NULL);
+    if (output_size < density_decompress_safe_size(descriptor.content_size))
+        return density_make_result(DENSITY_STATE_ERROR_OUTPUT_BUFFER_TOO_SMALL, in - input_buffer, 0, NULL);
+    const uint8_t *index = in;
+    in += sizeof(density_blocks_index_entry) * block_count;
+
+    // Every block's position in the input is resolved up front, so workers can start anywhere
+    uint_fast64_t *input_offsets = malloc(sizeof(uint_fast64_t) * (block_count + 1));
+    if (input_offsets == NULL)
+        return density_make_result(DENSITY_STATE_ERROR_DURING_PROCESSING, in - input_buffer, 0, NULL);
+    input_offsets[0] = in - input_buffer;
+    for (uint_fast64_t block = 0; block < block_count; block++)
+        input_offsets[block + 1] = input_offsets[block] + density_blocks_index_read(index, block);
+    if (input_offsets[block_count] > input_size) {
+        free(input_offsets);
+        return density_make_result(DENSITY_STATE_ERROR_INPUT_BUFFER_TOO_SMALL, in - input_buffer, 0, NULL);
+    }
+
+    // Workers setup
+    const uint_fast16_t threads = density_parallel_threads(requested_threads, block_count);
+    density_parallel_worker workers[DENSITY_THREADS_MAXIMUM];
+    for (uint_fast16_t id = 0; id < threads; id++) {
+        density_parallel_worker *const worker = &workers[id];
+        worker->input_buffer = input_buffer;
+        worker->output_buffer = output_buffer;
+        worker->output_end = output_buffer + output_size;
+        worker->output_stride = descriptor.block_size;
+        worker->index = NULL;
+        worker->input_offsets = input_offsets;
+        worker->output_offsets = NULL;
+        worker->descriptor = descriptor;
+        worker->block_count = block_count;
+        worker->algorithm = (DENSITY_ALGORITHM) main_header.algorithm;
+        worker->context = density_parallel_prepare_context(worker->algorithm, main_header.hash_bits, descriptor.block_size);
+        worker->pair_context = NULL;
+        worker->first_block = block_count * id / threads;   // Contiguous runs
+        worker->block_step = 1;
+        worker->end_block = block_count * (id + 1) / threads;
+        worker->status = DENSITY_ALGORITHMS_EXIT_STATUS_ERROR_DURING_PROCESSING;
+        if (worker->context == NULL) {
+            for (uint_fast16_t allocated = 0; allocated < id; allocated++)
+                density_free_context(workers[allocated].context, NULL);
+            free(input_offsets);
+            return density_make_result(DENSITY_STATE_ERROR_DURING_PROCESSING, in - input_buffer, 0, NULL);
+        }
+    }
+
+    // Decompression, straight into every block's final position
+    density_parallel_run(workers, threads, density_decompress_parallel_worker, density_decompress_parallel_blocks);
+    density_algorithm_exit_status status = DENSITY_ALGORITHMS_EXIT_STATUS_FINISHED;
+    for (uint_fast16_t id = 0; id < threads; id++) {
+        if (workers[id].status)
+            status = workers[id].status;
+        density_free_context(workers[id].context, NULL);
+    }
+    const uint_fast64_t read = input_offsets[block_count];
+    free(input_offsets);
+    if (status)
+        return density_make_result(density_convert_algorithm_exit_status(status), in - input_buffer, 0, NULL);
+
+    return density_make_result(DENSITY_STATE_OK, read, descriptor.content_size, NULL);
+}
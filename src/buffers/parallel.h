@@ -0,0 +1,78 @@
+/*
+ * Centaurean Density
+ *
+ * Copyright (c) 2013, Guillaume Voirin
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     1. Redistributions of source code must retain the above copyright notice, this
+ *        list of conditions and the following disclaimer.
+ *
+ *     2. Redistributions in binary form must reproduce the above copyright notice,
+ *        this list of conditions and the following disclaimer in the documentation
+ *        and/or other materials provided with the distribution.
+ *
+ *     3. Neither the name of the copyright holder nor the names of its
+ *        contributors may be used to endorse or promote products derived from
+ *        this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * 17/10/26 04:06
+ */
+
+#ifndef DENSITY_PARALLEL_H
+#define DENSITY_PARALLEL_H
+
+#include "../globals.h"
+#include "../density_api.h"
+#include "../structure/header.h"
+#include "../structure/blocks.h"
+#include "../algorithms/algorithms.h"
+#include "../algorithms/dictionaries.h"
+#include "../threads/threads.h"
+#include "buffer.h"
+
+#define DENSITY_PARALLEL_TAIL_SIZE                  (2 * DENSITY_MAX_3(DENSITY_CHAMELEON_DECOMPRESSED_UNIT_SIZE, DENSITY_CHEETAH_DECOMPRESSED_UNIT_SIZE, DENSITY_LION_MAXIMUM_DECOMPRESSED_UNIT_SIZE))     // A block's last unit and the decoder's slack
+
+typedef struct {
+    const uint8_t *input_buffer;
+    uint8_t *output_buffer;
+    uint8_t *output_end;
+    uint_fast64_t output_stride;
+    uint8_t *index;
+    const uint_fast64_t *input_offsets;
+    const uint_fast64_t *output_offsets;
+    density_blocks_descriptor descriptor;
+    uint_fast64_t block_count;
+    DENSITY_ALGORITHM algorithm;
+    density_context *context;
+    density_context *pair_context;  // Second dictionary for encoding the two halves of the run in lockstep, NULL if unused
+    uint_fast64_t first_block;
+    uint_fast64_t block_step;
+    uint_fast64_t end_block;        // One past the last block of a contiguous run, for workers which do not interleave
+    density_algorithm_exit_status status;
+} density_parallel_worker;
+
+DENSITY_THREAD_FUNCTION(density_compress_parallel_worker, argument);
+DENSITY_THREAD_FUNCTION(density_decompress_parallel_worker, argument);
+DENSITY_THREAD_FUNCTION(density_decompress_parallel_segments_worker, argument);
+
+DENSITY_WINDOWS_EXPORT uint_fast64_t density_compress_parallel_safe_size(const uint_fast64_t, const uint_fast32_t);
+DENSITY_WINDOWS_EXPORT density_processing_result density_compress_parallel(const uint8_t *, const uint_fast64_t, uint8_t *, const uint_fast64_t, const DENSITY_ALGORITHM, const uint_fast32_t, const uint_fast16_t);
+DENSITY_WINDOWS_EXPORT density_processing_result density_compress_parallel_with_hash_bits(const uint8_t *, const uint_fast64_t, uint8_t *, const uint_fast64_t, const DENSITY_ALGORITHM, const uint8_t, const uint_fast32_t, const uint_fast16_t);
+
+DENSITY_WINDOWS_EXPORT density_processing_result density_decompress_parallel(const uint8_t *, const uint_fast64_t, uint8_t *, const uint_fast64_t, const uint_fast16_t);
+
+#endif
@@ -0,0 +1,123 @@
+/*
+ * Centaurean Density
+ *
+ * Copyright (c) 2013, Guillaume Voirin
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     1. Redistributions of source code must retain the above copyright notice, this
+ *        list of conditions and the following disclaimer.
+ *
+ *     2. Redistributions in binary form must reproduce the above copyright notice,
+ *        this list of conditions and the following disclaimer in the documentation
+ *        and/or other materials provided with the distribution.
+ *
+ *     3. Neither the name of the copyright holder nor the names of its
+ *        contributors may be used to endorse or promote products derived from
+ *        this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * 17/10/26 09:28
+ */
+
+#include "range.h"
+
+DENSITY_WINDOWS_EXPORT density_processing_result density_decompress_range(const uint8_t *input_buffer, const uint_fast64_t input_size, const uint_fast64_t offset, const uint_fast64_t length, uint8_t *output_buffer, const uint_fast64_t output_size) {
+    // Read header
+    const uint8_t *in = input_buffer;
+    density_header main_header;
+    uint_fast64_t content_size;
+    uint_fast32_t dictionary_id;
+    const DENSITY_STATE frame_state = density_frame_read(&in, input_size, &main_header, &content_size, &dictionary_id);
+    if (frame_state)
+        return density_make_result(frame_state, in - input_buffer, 0, NULL);
+    if (!(main_header.flags & DENSITY_HEADER_FLAG_BLOCKS))
+        return density_make_result(DENSITY_STATE_ERROR_INVALID_HEADER, in - input_buffer, 0, NULL);
+
+    // Read frame
+    density_blocks_descriptor descriptor;
+    density_blocks_descriptor_read(&in, &descriptor);
+    if (descriptor.block_size < DENSITY_BLOCKS_MINIMUM_SIZE || descriptor.block_size > DENSITY_BLOCKS_MAXIMUM_SIZE)
+        return density_make_result(DENSITY_STATE_ERROR_DURING_PROCESSING, in - input_buffer, 0, NULL);
+    const uint_fast64_t block_count = density_blocks_count(descriptor.content_size, descriptor.block_size);
+    if (block_count > (input_size - (in - input_buffer)) / sizeof(density_blocks_index_entry))
+        return density_make_result(DENSITY_STATE_ERROR_INPUT_BUFFER_TOO_SMALL, in - input_buffer, 0, NULL);
+    const uint8_t *index = in;
+    in += sizeof(density_blocks_index_entry) * block_count;
+
+    // The range is clipped to the content, like a read past the end of a file
+    const uint_fast64_t start = offset < content_size ? offset : content_size;
+    const uint_fast64_t end = length < content_size - start ? start + length : content_size;
+    if (output_size < end - start)
+        return density_make_result(DENSITY_STATE_ERROR_OUTPUT_BUFFER_TOO_SMALL, in - input_buffer, 0, NULL);
+    if (start == end)
+        return density_make_result(DENSITY_STATE_OK, in - input_buffer, 0, NULL);
+
+    // Locating the first block sums the index entries in front of it, a linear walk over 4 bytes per block
+    const uint_fast64_t first_block = start / descriptor.block_size;
+    const uint_fast64_t last_block = (end - 1) / descriptor.block_size;
+    uint_fast64_t input_offset = (uint_fast64_t) (in - input_buffer);
+    for (uint_fast64_t block = 0; block < first_block; block++)
+        input_offset += density_blocks_index_read(index, block);
+
+    density_context *const context = density_cached_context((DENSITY_ALGORITHM) main_header.algorithm, main_header.hash_bits, 0);
+    if (context == NULL)
+        return density_make_result(DENSITY_STATE_ERROR_INVALID_CONTEXT, input_offset, 0, NULL);
+
+    uint8_t *out = output_buffer;
+    uint8_t *scratch = NULL;
+    density_algorithm_state state;
+    for (uint_fast64_t block = first_block; block <= last_block; block++) {
+        const uint_fast64_t compressed_size = density_blocks_index_read(index, block);
+        const uint_fast64_t decompressed_size = density_blocks_decompressed_size(&descriptor, block);
+        if (input_offset > input_size || compressed_size > input_size - input_offset) {
+            free(scratch);
+            return density_make_result(DENSITY_STATE_ERROR_INPUT_BUFFER_TOO_SMALL, input_offset, out - output_buffer, NULL);
+        }
+
+        // Blocks wholly inside the range are decoded in place when there is room for it, the others go through a scratch buffer
+        const uint_fast64_t block_start = block * descriptor.block_size;
+        const uint_fast64_t from = (start > block_start ? start : block_start) - block_start;
+        const uint_fast64_t to = (end < block_start + decompressed_size ? end : block_start + decompressed_size) - block_start;
+        const bool direct = !from && to == decompressed_size && output_size - (out - output_buffer) >= density_decompress_safe_size(decompressed_size);
+        if (!direct && scratch == NULL) {
+            scratch = malloc(density_decompress_safe_size(descriptor.block_size));
+            if (scratch == NULL)
+                return density_make_result(DENSITY_STATE_ERROR_DURING_PROCESSING, input_offset, out - output_buffer, NULL);
+        }
+
+        const uint8_t *block_in = input_buffer + input_offset;
+        uint8_t *const block_start_out = direct ? out : scratch;
+        uint8_t *block_out = block_start_out;
+        // Lazy reset only applies to blocks smaller than the dictionary, larger ones clear it as a whole
+        density_reset_context_for_size(context, decompressed_size);
+        density_algorithms_prepare_state(&state, context->dictionary, context->hash_bits);
+        state.epochs = (density_algorithm_epochs *) context->dictionary_epochs;
+        state.decompressed_size = decompressed_size;
+        const density_algorithm_exit_status status = density_algorithms_decode(&state, context->algorithm, &block_in, compressed_size, &block_out, density_decompress_safe_size(decompressed_size));
+        if (status || (uint_fast64_t) (block_out - block_start_out) != decompressed_size) {
+            free(scratch);
+            return density_make_result(status ? density_convert_algorithm_exit_status(status) : DENSITY_STATE_ERROR_DURING_PROCESSING, input_offset, out - output_buffer, NULL);
+        }
+
+        if (!direct)
+            DENSITY_MEMCPY(out, scratch + from, to - from);
+        out += to - from;
+        input_offset += compressed_size;
+    }
+
+    free(scratch);
+    return density_make_result(DENSITY_STATE_OK, input_offset, out - output_buffer, NULL);
+}
@@ -0,0 +1,278 @@
+/*
+ * Centaurean Density
+ *
+ * Copyright (c) 2013, Guillaume Voirin
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     1. Redistributions of source code must retain the above copyright notice, this
+ *        list of conditions and the following disclaimer.
+ *
+ *     2. Redistributions in binary form must reproduce the above copyright notice,
+ *        this list of conditions and the following disclaimer in the documentation
+ *        and/or other materials provided with the distribution.
+ *
+ *     3. Neither the name of the copyright holder nor the names of its
+ *        contributors may be used to endorse or promote products derived from
+ *        this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * 17/10/26 12:38
+ */
+
+#include "scatter.h"
+
+DENSITY_FORCE_INLINE uint_fast64_t density_iovec_size(const density_iovec *vector, const uint_fast64_t count) {
+    uint_fast64_t size = 0;
+    for (uint_fast64_t element = 0; element < count; element++)
+        size += vector[element].size;
+    return size;
+}
+
+DENSITY_WINDOWS_EXPORT uint_fast64_t density_compressv_safe_size(const uint_fast64_t input_size, const uint_fast64_t input_count) {
+    // Every element yields at most two segments, plus those split by the segment size limit
+    const uint_fast64_t segments = 2 * input_count + 2 * (input_size / DENSITY_SEGMENTS_SIZE) + 1;
+    return density_compress_safe_size(input_size) + segments * (sizeof(density_segment_header) + density_compress_safe_size(0)) + sizeof(density_segment_header);
+}
+
+DENSITY_FORCE_INLINE DENSITY_STATE density_compressv_segment(density_compressv_state *const compressv, const uint8_t *input_buffer, const uint_fast64_t input_size) {
+    if ((uint_fast64_t) (compressv->out_end - compressv->out) < sizeof(density_segment_header))
+        return DENSITY_STATE_ERROR_OUTPUT_BUFFER_TOO_SMALL;
+
+    uint8_t *segment_out = compressv->out + sizeof(density_segment_header);
+    const uint8_t *in = input_buffer;
+
+    density_algorithms_reset_copy_penalty(&compressv->state);   // As density_decompress_segment does
+    const density_algorithm_exit_status status = density_algorithms_encode(&compressv->state, compressv->context->algorithm, &in, input_size, &segment_out, (uint_fast64_t) (compressv->out_end - segment_out));
+    if (status)
+        return density_convert_algorithm_exit_status(status);
+    density_segment_header_write(compressv->out, (uint_fast32_t) input_size, (uint_fast32_t) (segment_out - compressv->out - sizeof(density_segment_header)));
+    compressv->out = segment_out;
+    return DENSITY_STATE_OK;
+}
+
+DENSITY_FORCE_INLINE DENSITY_STATE density_compressv_flush(density_compressv_state *const compressv) {
+    if (!compressv->staged)
+        return DENSITY_STATE_OK;
+    const DENSITY_STATE state = density_compressv_segment(compressv, compressv->staging, compressv->staged);
+    compressv->staged = 0;
+    return state;
+}
+
+DENSITY_FORCE_INLINE DENSITY_STATE density_compressv_stage(density_compressv_state *const compressv, const uint8_t *input_buffer, uint_fast64_t input_size) {
+    while (input_size) {
+        if (compressv->staging == NULL) {
+            compressv->staging = malloc(DENSITY_SEGMENTS_SIZE);
+            if (compressv->staging == NULL)
+                return DENSITY_STATE_ERROR_DURING_PROCESSING;
+        }
+        const uint_fast64_t room = DENSITY_SEGMENTS_SIZE - compressv->staged;
+        const uint_fast64_t bytes = input_size < room ? input_size : room;
+        DENSITY_MEMCPY(compressv->staging + compressv->staged, input_buffer, bytes);
+        compressv->staged += bytes;
+        input_buffer += bytes;
+        input_size -= bytes;
+        if (compressv->staged == DENSITY_SEGMENTS_SIZE) {
+            const DENSITY_STATE state = density_compressv_flush(compressv);
+            if (state)
+                return state;
+        }
+    }
+    return DENSITY_STATE_OK;
+}
+
+DENSITY_FORCE_INLINE DENSITY_STATE density_compressv_direct(density_compressv_state *const compressv, const uint8_t *input_buffer, uint_fast64_t input_size) {
+    DENSITY_STATE state = density_compressv_flush(compressv);
+    while (!state && input_size) {
+        const uint_fast64_t bytes = input_size < DENSITY_SEGMENTS_SIZE ? input_size : DENSITY_SEGMENTS_SIZE;
+        state = density_compressv_segment(compressv, input_buffer, bytes);
+        input_buffer += bytes;
+        input_size -= bytes;
+    }
+    return state;
+}
+
+DENSITY_WINDOWS_EXPORT density_processing_result density_compressv(const density_iovec *input, const uint_fast64_t input_count, uint8_t *output_buffer, const uint_fast64_t output_size, density_context *const context) {
+    if (context == NULL)
+        return density_make_result(DENSITY_STATE_ERROR_INVALID_CONTEXT, 0, 0, context);
+    if (context->dictionary_image != NULL)
+        return density_make_result(DENSITY_STATE_ERROR_INVALID_DICTIONARY, 0, 0, context);   // Segmented frames carry no dictionary id
+    if (output_size < sizeof(density_header) + sizeof(density_segment_header))
+        return density_make_result(DENSITY_STATE_ERROR_OUTPUT_BUFFER_TOO_SMALL, 0, 0, context);
+
+    // Variables setup
+    const uint_fast64_t tail_size = density_decompress_safe_size(0);
+    density_compressv_state compressv;
+    compressv.context = context;
+    compressv.staging = NULL;
+    compressv.staged = 0;
+    compressv.out = output_buffer;
+    compressv.out_end = output_buffer + output_size;
+    uint_fast64_t read = 0;
+    DENSITY_STATE state = DENSITY_STATE_OK;
+
+    // Every call encodes an independent frame, as a sequence of segments sharing the dictionary and algorithm state
+    density_header_write(&compressv.out, context->algorithm, DENSITY_HEADER_FLAG_SEGMENTS, context->hash_bits);
+    density_reset_context(context);
+    density_segments_prepare_state(context, &compressv.state, &compressv.model);
+
+    for (uint_fast64_t element = 0; element < input_count && !state; element++) {
+        const uint8_t *const buffer = (const uint8_t *) input[element].buffer;
+        const uint_fast64_t size = input[element].size;
+
+        // Elements are encoded in place, except for their last bytes which are gathered with small elements into separate segments,
+        // so that a segment decoded into a same sized output element leaves the room decoders may write past its end
+        if (size >= 2 * tail_size) {
+            state = density_compressv_direct(&compressv, buffer, size - tail_size);
+            if (!state)
+                state = density_compressv_stage(&compressv, buffer + size - tail_size, tail_size);
+        } else
+            state = density_compressv_stage(&compressv, buffer, size);
+        if (!state)
+            read += size;
+    }
+    if (!state)
+        state = density_compressv_flush(&compressv);
+    if (!state) {
+        if ((uint_fast64_t) (compressv.out_end - compressv.out) < sizeof(density_segment_header))
+            state = DENSITY_STATE_ERROR_OUTPUT_BUFFER_TOO_SMALL;
+        else {
+            density_segment_header_write(compressv.out, 0, 0);    // End marker
+            compressv.out += sizeof(density_segment_header);
+        }
+    }
+
+    free(compressv.staging);
+    return density_make_result(state, read, compressv.out - output_buffer, context);
+}
+
+DENSITY_FORCE_INLINE void density_decompressv_skip_full(const density_iovec **element, const density_iovec *const end, uint_fast64_t *offset) {
+    while (*element != end && *offset == (*element)->size) {
+        (*element)++;
+        *offset = 0;
+    }
+}
+
+DENSITY_FORCE_INLINE void density_decompressv_scatter(const uint8_t *data, uint_fast64_t size, const density_iovec **element, const density_iovec *const end, uint_fast64_t *offset) {
+    while (size) {
+        density_decompressv_skip_full(element, end, offset);
+        const uint_fast64_t room = (*element)->size - *offset;
+        const uint_fast64_t bytes = size < room ? size : room;
+        DENSITY_MEMCPY((uint8_t *) (*element)->buffer + *offset, data, bytes);
+        data += bytes;
+        size -= bytes;
+        *offset += bytes;
+    }
+}
+
+DENSITY_FORCE_INLINE DENSITY_STATE density_decompressv_segments(density_context *const context, const uint8_t **in, const uint8_t *const in_end, const density_iovec *output, const uint_fast64_t output_count, uint_fast64_t *written, uint8_t **scratch) {
+    // Variables setup
+    const density_iovec *element = output;
+    const density_iovec *const end = output + output_count;
+    const uint_fast64_t capacity = density_iovec_size(output, output_count);
+    uint_fast64_t offset = 0;
+    density_algorithm_state state;
+    density_lion_form_data model;
+    density_segment_header segment;
+
+    density_segments_prepare_state(context, &state, &model);
+    while (true) {
+        if ((uint_fast64_t) (in_end - *in) < sizeof(density_segment_header))
+            return DENSITY_STATE_ERROR_INPUT_BUFFER_TOO_SMALL;
+        density_segment_header_read(in, &segment);
+        if (!segment.decompressed_size) {
+            if (!segment.compressed_size)
+                return DENSITY_STATE_OK;    // End marker
+            if (segment.compressed_size != DENSITY_SEGMENTS_SYNC_MARKER)
+                return DENSITY_STATE_ERROR_DURING_PROCESSING;
+            density_reset_context(context);
+            density_segments_prepare_state(context, &state, &model);
+            continue;
+        }
+        if (segment.compressed_size > (uint_fast64_t) (in_end - *in))
+            return DENSITY_STATE_ERROR_INPUT_BUFFER_TOO_SMALL;
+        if (segment.decompressed_size > capacity - *written)
+            return DENSITY_STATE_ERROR_OUTPUT_BUFFER_TOO_SMALL;
+
+        // Segments are decoded in place when their element has room for what decoders may write past their end, otherwise scattered from a scratch buffer
+        density_decompressv_skip_full(&element, end, &offset);
+        const uint_fast64_t room = element->size - offset;
+        const bool direct = room >= density_decompress_safe_size(segment.decompressed_size);
+        if (!direct && *scratch == NULL) {
+            *scratch = malloc(density_decompress_safe_size(DENSITY_SEGMENTS_SIZE));
+            if (*scratch == NULL)
+                return DENSITY_STATE_ERROR_DURING_PROCESSING;
+        }
+        const DENSITY_STATE segment_state = density_decompress_segment(&state, context->algorithm, &segment, *in, direct ? (uint8_t *) element->buffer + offset : *scratch, direct ? room : density_decompress_safe_size(DENSITY_SEGMENTS_SIZE));
+        if (segment_state)
+            return segment_state;
+        if (direct)
+            offset += segment.decompressed_size;
+        else
+            density_decompressv_scatter(*scratch, segment.decompressed_size, &element, end, &offset);
+        *in += segment.compressed_size;
+        *written += segment.decompressed_size;
+    }
+}
+
+DENSITY_FORCE_INLINE density_processing_result density_decompressv_single_run(const uint8_t *input_buffer, const uint_fast64_t input_size, const density_iovec *output, const uint_fast64_t output_count, density_context *const context) {
+    // Frames which are not segmented cannot be decoded piecewise, and go through a scratch buffer
+    const uint_fast64_t capacity = density_iovec_size(output, output_count);
+    const bool content_size_known = (context->header_flags & (DENSITY_HEADER_FLAG_CONTENT_SIZE | DENSITY_HEADER_FLAG_BLOCKS)) != 0;
+    if (content_size_known && context->content_size > capacity)
+        return density_make_result(DENSITY_STATE_ERROR_OUTPUT_BUFFER_TOO_SMALL, 0, 0, context);
+    const uint_fast64_t scratch_size = density_decompress_safe_size(content_size_known ? context->content_size : capacity);
+    uint8_t *const scratch = malloc(scratch_size);
+    if (scratch == NULL)
+        return density_make_result(DENSITY_STATE_ERROR_DURING_PROCESSING, 0, 0, context);
+
+    density_processing_result result = density_decompress_with_context(input_buffer, input_size, scratch, scratch_size, context);
+    if (!result.state) {
+        if (result.bytesWritten > capacity)
+            result = density_make_result(DENSITY_STATE_ERROR_OUTPUT_BUFFER_TOO_SMALL, result.bytesRead, 0, context);
+        else {
+            const density_iovec *element = output;
+            uint_fast64_t offset = 0;
+            density_decompressv_scatter(scratch, result.bytesWritten, &element, output + output_count, &offset);
+        }
+    }
+    free(scratch);
+    return result;
+}
+
+DENSITY_WINDOWS_EXPORT density_processing_result density_decompressv(const uint8_t *input_buffer, const uint_fast64_t input_size, const density_iovec *output, const uint_fast64_t output_count, density_context *const context) {
+    const density_processing_result header = density_decompress_read_frame_header(input_buffer, input_size, context);
+    if (header.state)
+        return header;
+    const uint8_t *in = input_buffer + header.bytesRead;
+    if (context->header_dictionary_id != context->dictionary_id || !(context->header_flags & DENSITY_HEADER_FLAG_STATIC_DICTIONARY) != !context->dictionary_static) {
+        density_context_set_frame(context, 0, 0, 0);
+        return density_make_result(DENSITY_STATE_ERROR_INVALID_DICTIONARY, in - input_buffer, 0, context);
+    }
+
+    // Every frame is independent
+    density_reset_context(context);
+    if (!(context->header_flags & DENSITY_HEADER_FLAG_SEGMENTS)) {
+        const density_processing_result result = density_decompressv_single_run(in, input_size - (in - input_buffer), output, output_count, context);
+        return density_make_result(result.state, (in - input_buffer) + result.bytesRead, result.bytesWritten, context);
+    }
+
+    uint8_t *scratch = NULL;
+    uint_fast64_t written = 0;
+    const DENSITY_STATE state = density_decompressv_segments(context, &in, input_buffer + input_size, output, output_count, &written, &scratch);
+    free(scratch);
+    density_context_set_frame(context, 0, 0, 0);
+    return density_make_result(state, in - input_buffer, written, context);
+}
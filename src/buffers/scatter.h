@@ -0,0 +1,60 @@
+/*
+ * Centaurean Density
+ *
+ * Copyright (c) 2013, Guillaume Voirin
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     1. Redistributions of source code must retain the above copyright notice, this
+ *        list of conditions and the following disclaimer.
+ *
+ *     2. Redistributions in binary form must reproduce the above copyright notice,
+ *        this list of conditions and the following disclaimer in the documentation
+ *        and/or other materials provided with the distribution.
+ *
+ *     3. Neither the name of the copyright holder nor the names of its
+ *        contributors may be used to endorse or promote products derived from
+ *        this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * 17/10/26 12:38
+ */
+
+#ifndef DENSITY_SCATTER_H
+#define DENSITY_SCATTER_H
+
+#include "../globals.h"
+#include "../density_api.h"
+#include "../structure/header.h"
+#include "../structure/frame.h"
+#include "../structure/segments.h"
+#include "../algorithms/algorithms.h"
+#include "buffer.h"
+
+typedef struct {
+    density_context *context;
+    density_algorithm_state state;
+    density_lion_form_data model;
+    uint8_t *staging;                   // Element tails and small elements, gathered into whole segments
+    uint_fast64_t staged;
+    uint8_t *out;
+    const uint8_t *out_end;
+} density_compressv_state;
+
+DENSITY_WINDOWS_EXPORT uint_fast64_t density_compressv_safe_size(const uint_fast64_t, const uint_fast64_t);
+DENSITY_WINDOWS_EXPORT density_processing_result density_compressv(const density_iovec *, const uint_fast64_t, uint8_t *, const uint_fast64_t, density_context *const);
+DENSITY_WINDOWS_EXPORT density_processing_result density_decompressv(const uint8_t *, const uint_fast64_t, const density_iovec *, const uint_fast64_t, density_context *const);
+
+#endif
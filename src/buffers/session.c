@@ -0,0 +1,123 @@
+/*
+ * Centaurean Density
+ *
+ * Copyright (c) 2013, Guillaume Voirin
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     1. Redistributions of source code must retain the above copyright notice, this
+ *        list of conditions and the following disclaimer.
+ *
+ *     2. Redistributions in binary form must reproduce the above copyright notice,
+ *        this list of conditions and the following disclaimer in the documentation
+ *        and/or other materials provided with the distribution.
+ *
+ *     3. Neither the name of the copyright holder nor the names of its
+ *        contributors may be used to endorse or promote products derived from
+ *        this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * 17/10/26 12:07
+ */
+
+#include "session.h"
+
+DENSITY_WINDOWS_EXPORT void density_reset_session(density_context *const context) {
+    context->session_open = false;
+    context->session_sequence = 0;
+}
+
+DENSITY_WINDOWS_EXPORT density_processing_result density_compress_session(const uint8_t *input_buffer, const uint_fast64_t input_size, uint8_t *output_buffer, const uint_fast64_t output_size, density_context *const context) {
+    if (context == NULL)
+        return density_make_result(DENSITY_STATE_ERROR_INVALID_CONTEXT, 0, 0, context);
+
+    // Opening frame, from a fresh dictionary. Messages too large for a continuation frame open a new session as well
+    if (!context->session_open || input_size > UINT32_MAX) {
+        density_reset_session(context);
+        density_reset_context(context);
+        const density_processing_result result = density_compress_frame(input_buffer, input_size, output_buffer, output_size, context, DENSITY_HEADER_FLAG_SESSION);
+        if (result.state == DENSITY_STATE_OK) {
+            context->session_open = true;
+            context->session_sequence = 1;
+        }
+        return result;
+    }
+
+    // Continuation frame
+    if (output_size < sizeof(density_session_header))
+        return density_make_result(DENSITY_STATE_ERROR_OUTPUT_BUFFER_TOO_SMALL, 0, 0, context);
+    const uint8_t *in = input_buffer;
+    uint8_t *out = output_buffer;
+    density_session_header_write(&out, (uint_fast16_t) (context->session_sequence & 0xffff), (uint_fast32_t) input_size);
+    density_algorithm_state state;
+    density_context_prepare_state(context, &state);
+    const density_algorithm_exit_status status = density_algorithms_encode(&state, context->algorithm, &in, input_size, &out, output_size - (out - output_buffer));
+    if (status)
+        density_reset_session(context);     // The dictionary is now out of step with the decoder's, the next message opens a new session
+    else
+        context->session_sequence++;
+    return density_make_result(density_convert_algorithm_exit_status(status), in - input_buffer, out - output_buffer, context);
+}
+
+DENSITY_FORCE_INLINE density_processing_result density_decompress_session_opening(const uint8_t *input_buffer, const uint_fast64_t input_size, uint8_t *output_buffer, const uint_fast64_t output_size, density_context *const context) {
+    const density_processing_result header = density_decompress_read_frame_header(input_buffer, input_size, context);
+    if (header.state)
+        return header;
+    if (!(context->header_flags & DENSITY_HEADER_FLAG_SESSION)) {
+        density_context_set_frame(context, 0, 0, 0);
+        return density_make_result(DENSITY_STATE_ERROR_INVALID_HEADER, header.bytesRead, 0, context);
+    }
+
+    // Decoding resynchronizes on any opening frame
+    density_reset_session(context);
+    density_reset_context(context);
+    const density_processing_result result = density_decompress_with_context(input_buffer + header.bytesRead, input_size - header.bytesRead, output_buffer, output_size, context);
+    if (result.state == DENSITY_STATE_OK) {
+        context->session_open = true;
+        context->session_sequence = 1;
+    }
+    return density_make_result(result.state, header.bytesRead + result.bytesRead, result.bytesWritten, context);
+}
+
+DENSITY_WINDOWS_EXPORT density_processing_result density_decompress_session(const uint8_t *input_buffer, const uint_fast64_t input_size, uint8_t *output_buffer, const uint_fast64_t output_size, density_context *const context) {
+    if (context == NULL)
+        return density_make_result(DENSITY_STATE_ERROR_INVALID_CONTEXT, 0, 0, context);
+    if (input_size < sizeof(density_session_header))
+        return density_make_result(DENSITY_STATE_ERROR_INPUT_BUFFER_TOO_SMALL, 0, 0, context);
+    if (input_buffer[0] != DENSITY_SESSION_MARKER)
+        return density_decompress_session_opening(input_buffer, input_size, output_buffer, output_size, context);
+
+    // Continuation frame, checked before the dictionary is touched so that the expected message can still be supplied
+    const uint8_t *in = input_buffer;
+    uint8_t *out = output_buffer;
+    density_session_header header;
+    density_session_header_read(&in, &header);
+    if (!context->session_open || header.sequence != (context->session_sequence & 0xffff))
+        return density_make_result(DENSITY_STATE_ERROR_SESSION_OUT_OF_SYNC, 0, 0, context);
+    if (output_size < header.decompressed_size)
+        return density_make_result(DENSITY_STATE_ERROR_OUTPUT_BUFFER_TOO_SMALL, 0, 0, context);
+
+    density_algorithm_state state;
+    density_context_prepare_state(context, &state);
+    state.decompressed_size = header.decompressed_size;
+    density_algorithm_exit_status status = density_algorithms_decode(&state, context->algorithm, &in, input_size - sizeof(density_session_header), &out, output_size);
+    if (!status && (uint_fast64_t) (out - output_buffer) != header.decompressed_size)
+        status = DENSITY_ALGORITHMS_EXIT_STATUS_ERROR_DURING_PROCESSING;
+    if (status)
+        density_reset_session(context);     // The dictionary can no longer be trusted, only an opening frame resynchronizes
+    else
+        context->session_sequence++;
+    return density_make_result(density_convert_algorithm_exit_status(status), in - input_buffer, out - output_buffer, context);
+}
@@ -0,0 +1,346 @@
+/*
+ * Centaurean Density
+ *
+ * Copyright (c) 2013, Guillaume Voirin
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     1. Redistributions of source code must retain the above copyright notice, this
+ *        list of conditions and the following disclaimer.
+ *
+ *     2. Redistributions in binary form must reproduce the above copyright notice,
+ *        this list of conditions and the following disclaimer in the documentation
+ *        and/or other materials provided with the distribution.
+ *
+ *     3. Neither the name of the copyright holder nor the names of its
+ *        contributors may be used to endorse or promote products derived from
+ *        this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * 17/10/26 08:54
+ */
+
+#include "stream.h"
+
+DENSITY_FORCE_INLINE uint_fast64_t density_stream_segment_bound(void) {
+    return 2 * sizeof(density_segment_header) + density_compress_safe_size(DENSITY_SEGMENTS_SIZE);   // Optional sync marker, then the segment
+}
+
+DENSITY_FORCE_INLINE density_stream *density_stream_allocate(const bool compression, void *(*mem_alloc)(size_t)) {
+    density_stream *stream = mem_alloc(sizeof(density_stream));
+    stream->compression = compression;
+    stream->context = NULL;
+    stream->mem_alloc = mem_alloc;
+    stream->input = mem_alloc(compression ? DENSITY_SEGMENTS_SIZE : density_compress_safe_size(DENSITY_SEGMENTS_SIZE));
+    stream->input_available = 0;
+    stream->output = mem_alloc(compression ? density_stream_segment_bound() : density_decompress_safe_size(DENSITY_SEGMENTS_SIZE));
+    stream->output_start = 0;
+    stream->output_end = 0;
+    stream->sync_interval = 0;
+    stream->segments_since_sync_point = 0;
+    return stream;
+}
+
+DENSITY_FORCE_INLINE void density_stream_prepare_state(density_stream *const stream) {
+    density_algorithms_prepare_state(&stream->state, stream->context->dictionary, stream->context->hash_bits);
+    stream->state.epochs = (density_algorithm_epochs *) stream->context->dictionary_epochs;
+    density_lion_form_model_init(&stream->model);
+    stream->state.model = &stream->model;
+}
+
+DENSITY_FORCE_INLINE bool density_stream_gather(density_stream *const stream, const uint8_t **in, const uint8_t *const in_end, const uint_fast64_t size) {
+    const uint_fast64_t missing = size - stream->input_available;
+    const uint_fast64_t available = (uint_fast64_t) (in_end - *in);
+    const uint_fast64_t bytes = missing < available ? missing : available;
+    DENSITY_MEMCPY(stream->input + stream->input_available, *in, bytes);
+    *in += bytes;
+    stream->input_available += bytes;
+    return stream->input_available == size;
+}
+
+DENSITY_FORCE_INLINE bool density_stream_flush(density_stream *const stream, uint8_t **out, const uint8_t *const out_end) {
+    const uint_fast64_t pending = stream->output_end - stream->output_start;
+    const uint_fast64_t room = (uint_fast64_t) (out_end - *out);
+    const uint_fast64_t bytes = pending < room ? pending : room;
+    DENSITY_MEMCPY(*out, stream->output + stream->output_start, bytes);
+    *out += bytes;
+    stream->output_start += bytes;
+    if (stream->output_start != stream->output_end)
+        return false;
+    stream->output_start = 0;
+    stream->output_end = 0;
+    return true;
+}
+
+DENSITY_FORCE_INLINE DENSITY_STATE density_stream_compress_segment(density_stream *const stream, const uint8_t *input_buffer, const uint_fast64_t input_size, uint8_t **out, const uint8_t *const out_end) {
+    // Straight to the caller's buffer when a segment fits there whatever its compressibility
+    const bool direct = (uint_fast64_t) (out_end - *out) >= density_stream_segment_bound();
+    uint8_t *segment_start = direct ? *out : stream->output;
+
+    // Sync point : everything starts over so that decoding can begin here
+    if (stream->sync_interval && stream->segments_since_sync_point == stream->sync_interval) {
+        density_segment_header_write(segment_start, 0, DENSITY_SEGMENTS_SYNC_MARKER);
+        segment_start += sizeof(density_segment_header);
+        density_reset_context(stream->context);
+        density_stream_prepare_state(stream);
+        stream->segments_since_sync_point = 0;
+    }
+    stream->segments_since_sync_point++;
+
+    uint8_t *segment_out = segment_start + sizeof(density_segment_header);
+    const uint8_t *in = input_buffer;
+
+    density_algorithms_reset_copy_penalty(&stream->state);   // As density_decompress_segment does
+    const density_algorithm_exit_status status = density_algorithms_encode(&stream->state, stream->context->algorithm, &in, input_size, &segment_out, density_compress_safe_size(DENSITY_SEGMENTS_SIZE));
+    if (status)
+        return density_convert_algorithm_exit_status(status);
+    density_segment_header_write(segment_start, (uint_fast32_t) input_size, (uint_fast32_t) (segment_out - segment_start - sizeof(density_segment_header)));
+
+    if (direct)
+        *out = segment_out;
+    else
+        stream->output_end = (uint_fast64_t) (segment_out - stream->output);
+    return DENSITY_STATE_OK;
+}
+
+DENSITY_WINDOWS_EXPORT density_stream *density_stream_prepare_compression(const DENSITY_ALGORITHM algorithm, void *(*mem_alloc)(size_t)) {
+    if (!density_get_dictionary_size(algorithm))
+        return NULL;
+    if (mem_alloc == NULL)
+        mem_alloc = malloc;
+
+    density_stream *stream = density_stream_allocate(true, mem_alloc);
+    stream->context = density_compress_prepare_context(algorithm, false, mem_alloc).context;
+    density_stream_prepare_state(stream);
+    stream->phase = DENSITY_STREAM_PHASE_SEGMENT;
+
+    // The header is the first output
+    uint8_t *out = stream->output;
+    density_header_write(&out, algorithm, DENSITY_HEADER_FLAG_SEGMENTS, stream->context->hash_bits);
+    stream->output_end = (uint_fast64_t) (out - stream->output);
+    return stream;
+}
+
+DENSITY_WINDOWS_EXPORT DENSITY_STATE density_stream_set_sync_interval(density_stream *const stream, const uint_fast64_t interval) {
+    if (stream == NULL || !stream->compression || stream->phase != DENSITY_STREAM_PHASE_SEGMENT || stream->segments_since_sync_point || stream->input_available)
+        return DENSITY_STATE_ERROR_INVALID_CONTEXT;
+
+    // Sync points fall between segments
+    stream->sync_interval = (interval + DENSITY_SEGMENTS_SIZE - 1) / DENSITY_SEGMENTS_SIZE;
+    if (stream->sync_interval && stream->sync_interval * DENSITY_SEGMENTS_SIZE <= density_get_dictionary_size_with_hash_bits(stream->context->algorithm, stream->context->hash_bits))
+        return density_enable_lazy_reset(stream->context, stream->mem_alloc);
+    return DENSITY_STATE_OK;
+}
+
+DENSITY_WINDOWS_EXPORT density_processing_result density_stream_compress_continue(density_stream *const stream, const uint8_t *input_buffer, const uint_fast64_t input_size, uint8_t *output_buffer, const uint_fast64_t output_size) {
+    if (stream == NULL || !stream->compression || stream->phase != DENSITY_STREAM_PHASE_SEGMENT)
+        return density_make_result(DENSITY_STATE_ERROR_INVALID_CONTEXT, 0, 0, NULL);
+
+    // Variables setup
+    const uint8_t *in = input_buffer;
+    const uint8_t *const in_end = input_buffer + input_size;
+    uint8_t *out = output_buffer;
+    const uint8_t *const out_end = output_buffer + output_size;
+
+    while (density_stream_flush(stream, &out, out_end)) {
+        const uint8_t *segment;
+        if (!stream->input_available && (uint_fast64_t) (in_end - in) >= DENSITY_SEGMENTS_SIZE) {
+            segment = in;
+            in += DENSITY_SEGMENTS_SIZE;
+        } else if (density_stream_gather(stream, &in, in_end, DENSITY_SEGMENTS_SIZE)) {
+            segment = stream->input;
+            stream->input_available = 0;
+        } else
+            return density_make_result(DENSITY_STATE_OK, in - input_buffer, out - output_buffer, stream->context);
+
+        const DENSITY_STATE state = density_stream_compress_segment(stream, segment, DENSITY_SEGMENTS_SIZE, &out, out_end);
+        if (state)
+            return density_make_result(state, in - input_buffer, out - output_buffer, stream->context);
+    }
+
+    return density_make_result(DENSITY_STATE_STALL_ON_OUTPUT, in - input_buffer, out - output_buffer, stream->context);
+}
+
+DENSITY_WINDOWS_EXPORT density_processing_result density_stream_compress_finish(density_stream *const stream, uint8_t *output_buffer, const uint_fast64_t output_size) {
+    if (stream == NULL || !stream->compression)
+        return density_make_result(DENSITY_STATE_ERROR_INVALID_CONTEXT, 0, 0, NULL);
+
+    // Variables setup
+    uint8_t *out = output_buffer;
+    const uint8_t *const out_end = output_buffer + output_size;
+
+    while (density_stream_flush(stream, &out, out_end)) {
+        if (stream->phase == DENSITY_STREAM_PHASE_FINISHED)
+            return density_make_result(DENSITY_STATE_OK, 0, out - output_buffer, stream->context);
+
+        if (stream->input_available) {
+            const DENSITY_STATE state = density_stream_compress_segment(stream, stream->input, stream->input_available, &out, out_end);
+            if (state)
+                return density_make_result(state, 0, out - output_buffer, stream->context);
+            stream->input_available = 0;
+        } else {
+            density_segment_header_write(stream->output, 0, 0);    // End marker
+            stream->output_end = sizeof(density_segment_header);
+            stream->phase = DENSITY_STREAM_PHASE_FINISHED;
+        }
+    }
+
+    return density_make_result(DENSITY_STATE_STALL_ON_OUTPUT, 0, out - output_buffer, stream->context);
+}
+
+DENSITY_WINDOWS_EXPORT density_stream *density_stream_prepare_decompression(void *(*mem_alloc)(size_t)) {
+    if (mem_alloc == NULL)
+        mem_alloc = malloc;
+
+    density_stream *stream = density_stream_allocate(false, mem_alloc);
+    stream->phase = DENSITY_STREAM_PHASE_HEADER;
+    return stream;
+}
+
+DENSITY_WINDOWS_EXPORT density_processing_result density_stream_decompress_continue(density_stream *const stream, const uint8_t *input_buffer, const uint_fast64_t input_size, uint8_t *output_buffer, const uint_fast64_t output_size) {
+    if (stream == NULL || stream->compression)
+        return density_make_result(DENSITY_STATE_ERROR_INVALID_CONTEXT, 0, 0, NULL);
+
+    // Variables setup
+    const uint8_t *in = input_buffer;
+    const uint8_t *const in_end = input_buffer + input_size;
+    uint8_t *out = output_buffer;
+    const uint8_t *const out_end = output_buffer + output_size;
+    density_processing_result result;
+    DENSITY_STATE state;
+
+    while (density_stream_flush(stream, &out, out_end)) {
+        switch (stream->phase) {
+            case DENSITY_STREAM_PHASE_HEADER: {
+                if (!density_stream_gather(stream, &in, in_end, sizeof(density_header)))
+                    return density_make_result(DENSITY_STATE_STALL_ON_INPUT, in - input_buffer, out - output_buffer, stream->context);
+
+                const uint8_t *header_in = stream->input;
+                density_header main_header;
+                density_header_read(&header_in, &main_header);
+                if (main_header.flags & DENSITY_HEADER_FLAG_METADATA) {
+                    stream->input_available = 0;
+                    stream->phase = DENSITY_STREAM_PHASE_METADATA_SIZE;
+                    break;
+                }
+                stream->input_available = 0;
+
+                result = density_decompress_prepare_context(stream->input, sizeof(density_header), false, stream->mem_alloc);
+                if (result.state)
+                    return density_make_result(result.state, in - input_buffer, out - output_buffer, NULL);
+                if (!density_get_dictionary_size(result.context->algorithm) || !(result.context->header_flags & DENSITY_HEADER_FLAG_SEGMENTS)) {
+                    density_free_context(result.context, NULL);
+                    return density_make_result(DENSITY_STATE_ERROR_DURING_PROCESSING, in - input_buffer, out - output_buffer, NULL);
+                }
+                stream->context = result.context;
+                density_stream_prepare_state(stream);
+                stream->phase = DENSITY_STREAM_PHASE_SEGMENT_HEADER;
+                break;
+            }
+            case DENSITY_STREAM_PHASE_METADATA_SIZE: {
+                if (!density_stream_gather(stream, &in, in_end, sizeof(density_frame_metadata_size)))
+                    return density_make_result(DENSITY_STATE_STALL_ON_INPUT, in - input_buffer, out - output_buffer, stream->context);
+                stream->input_available = 0;
+
+                density_frame_metadata_size metadata_size;
+                DENSITY_MEMCPY(&metadata_size, stream->input, sizeof(density_frame_metadata_size));
+                stream->metadata_remaining = DENSITY_LITTLE_ENDIAN_32(metadata_size);
+                stream->phase = DENSITY_STREAM_PHASE_METADATA;
+                break;
+            }
+            case DENSITY_STREAM_PHASE_METADATA: {
+                // Metadata frames are skipped
+                const uint_fast64_t available = (uint_fast64_t) (in_end - in);
+                const uint_fast64_t bytes = stream->metadata_remaining < available ? stream->metadata_remaining : available;
+                in += bytes;
+                stream->metadata_remaining -= bytes;
+                if (stream->metadata_remaining)
+                    return density_make_result(DENSITY_STATE_STALL_ON_INPUT, in - input_buffer, out - output_buffer, stream->context);
+                stream->phase = DENSITY_STREAM_PHASE_HEADER;
+                break;
+            }
+            case DENSITY_STREAM_PHASE_SEGMENT_HEADER: {
+                if (!density_stream_gather(stream, &in, in_end, sizeof(density_segment_header)))
+                    return density_make_result(DENSITY_STATE_STALL_ON_INPUT, in - input_buffer, out - output_buffer, stream->context);
+                stream->input_available = 0;
+
+                const uint8_t *segment_header = stream->input;
+                density_segment_header_read(&segment_header, &stream->segment);
+                if (!stream->segment.decompressed_size) {
+                    if (!stream->segment.compressed_size)
+                        stream->phase = DENSITY_STREAM_PHASE_FINISHED;  // End marker
+                    else if (stream->segment.compressed_size == DENSITY_SEGMENTS_SYNC_MARKER) {
+                        // The interval is the length of the first run, lazy reset is enabled on the same condition as when compressing
+                        if (!stream->sync_interval) {
+                            stream->sync_interval = stream->segments_since_sync_point;
+                            if (stream->sync_interval * DENSITY_SEGMENTS_SIZE <= stream->context->dictionary_size)
+                                density_enable_lazy_reset(stream->context, stream->mem_alloc);     // The dictionary is cleared as a whole otherwise
+                        }
+                        stream->segments_since_sync_point = 0;
+                        density_reset_context(stream->context);
+                        density_stream_prepare_state(stream);
+                    } else
+                        return density_make_result(DENSITY_STATE_ERROR_DURING_PROCESSING, in - input_buffer, out - output_buffer, stream->context);
+                } else if (stream->segment.decompressed_size > DENSITY_SEGMENTS_SIZE || stream->segment.compressed_size > density_compress_safe_size(DENSITY_SEGMENTS_SIZE))
+                    return density_make_result(DENSITY_STATE_ERROR_DURING_PROCESSING, in - input_buffer, out - output_buffer, stream->context);
+                else
+                    stream->phase = DENSITY_STREAM_PHASE_SEGMENT;
+                break;
+            }
+            case DENSITY_STREAM_PHASE_SEGMENT: {
+                const uint8_t *segment;
+                if (!stream->input_available && (uint_fast64_t) (in_end - in) >= stream->segment.compressed_size) {
+                    segment = in;
+                    in += stream->segment.compressed_size;
+                } else if (density_stream_gather(stream, &in, in_end, stream->segment.compressed_size)) {
+                    segment = stream->input;
+                    stream->input_available = 0;
+                } else
+                    return density_make_result(DENSITY_STATE_STALL_ON_INPUT, in - input_buffer, out - output_buffer, stream->context);
+
+                if ((uint_fast64_t) (out_end - out) >= density_decompress_safe_size(stream->segment.decompressed_size)) {
+                    state = density_decompress_segment(&stream->state, stream->context->algorithm, &stream->segment, segment, out, (uint_fast64_t) (out_end - out));
+                    if (!state)
+                        out += stream->segment.decompressed_size;
+                } else {
+                    state = density_decompress_segment(&stream->state, stream->context->algorithm, &stream->segment, segment, stream->output, density_decompress_safe_size(DENSITY_SEGMENTS_SIZE));
+                    if (!state)
+                        stream->output_end = stream->segment.decompressed_size;
+                }
+                if (state)
+                    return density_make_result(state, in - input_buffer, out - output_buffer, stream->context);
+                stream->segments_since_sync_point++;
+                stream->phase = DENSITY_STREAM_PHASE_SEGMENT_HEADER;
+                break;
+            }
+            default:
+                return density_make_result(DENSITY_STATE_OK, in - input_buffer, out - output_buffer, stream->context);
+        }
+    }
+
+    return density_make_result(DENSITY_STATE_STALL_ON_OUTPUT, in - input_buffer, out - output_buffer, stream->context);
+}
+
+DENSITY_WINDOWS_EXPORT void density_stream_free(density_stream *const stream, void (*mem_free)(void *)) {
+    if (stream == NULL)
+        return;
+    if (mem_free == NULL)
+        mem_free = free;
+
+    density_free_context(stream->context, mem_free);
+    mem_free(stream->input);
+    mem_free(stream->output);
+    mem_free(stream);
+}
@@ -0,0 +1,86 @@
+/*
+ * Centaurean Density
+ *
+ * Copyright (c) 2013, Guillaume Voirin
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     1. Redistributions of source code must retain the above copyright notice, this
+ *        list of conditions and the following disclaimer.
+ *
+ *     2. Redistributions in binary form must reproduce the above copyright notice,
+ *        this list of conditions and the following disclaimer in the documentation
+ *        and/or other materials provided with the distribution.
+ *
+ *     3. Neither the name of the copyright holder nor the names of its
+ *        contributors may be used to endorse or promote products derived from
+ *        this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * 17/10/26 08:54
+ */
+
+#ifndef DENSITY_STREAM_H
+#define DENSITY_STREAM_H
+
+#include "../globals.h"
+#include "../density_api.h"
+#include "../structure/header.h"
+#include "../structure/segments.h"
+#include "../algorithms/algorithms.h"
+#include "../algorithms/dictionaries.h"
+#include "../algorithms/lion/forms/lion_form_model.h"
+#include "buffer.h"
+
+typedef enum {
+    DENSITY_STREAM_PHASE_HEADER,
+    DENSITY_STREAM_PHASE_METADATA_SIZE,
+    DENSITY_STREAM_PHASE_METADATA,
+    DENSITY_STREAM_PHASE_SEGMENT_HEADER,
+    DENSITY_STREAM_PHASE_SEGMENT,
+    DENSITY_STREAM_PHASE_FINISHED
+} DENSITY_STREAM_PHASE;
+
+/*
+ * Input is staged until a whole segment (or header) is available, and output is staged until the caller provides room for it.
+ * Both stages are bypassed whenever the caller's buffers are large enough.
+ */
+struct density_stream {
+    bool compression;
+    DENSITY_STREAM_PHASE phase;
+    density_context *context;
+    density_algorithm_state state;
+    density_lion_form_data model;
+    density_segment_header segment;
+    uint_fast64_t metadata_remaining;
+    uint_fast64_t sync_interval;                // In segments, 0 when sync points are disabled or, when decoding, none was met yet
+    uint_fast64_t segments_since_sync_point;
+    void *(*mem_alloc)(size_t);
+    uint8_t *input;
+    uint_fast64_t input_available;
+    uint8_t *output;
+    uint_fast64_t output_start;
+    uint_fast64_t output_end;
+};
+
+DENSITY_WINDOWS_EXPORT density_stream *density_stream_prepare_compression(const DENSITY_ALGORITHM, void *(*)(size_t));
+DENSITY_WINDOWS_EXPORT DENSITY_STATE density_stream_set_sync_interval(density_stream *const, const uint_fast64_t);
+DENSITY_WINDOWS_EXPORT density_processing_result density_stream_compress_continue(density_stream *const, const uint8_t *, const uint_fast64_t, uint8_t *, const uint_fast64_t);
+DENSITY_WINDOWS_EXPORT density_processing_result density_stream_compress_finish(density_stream *const, uint8_t *, const uint_fast64_t);
+DENSITY_WINDOWS_EXPORT density_stream *density_stream_prepare_decompression(void *(*)(size_t));
+DENSITY_WINDOWS_EXPORT density_processing_result density_stream_decompress_continue(density_stream *const, const uint8_t *, const uint_fast64_t, uint8_t *, const uint_fast64_t);
+DENSITY_WINDOWS_EXPORT void density_stream_free(density_stream *const, void (*)(void *));
+
+#endif
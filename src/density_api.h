@@ -59,6 +59,10 @@ extern "C" {
 typedef uint8_t density_byte;
 typedef bool density_bool;
 
+#define DENSITY_HASH_BITS_MINIMUM   12      // Smallest dictionary, 4096 hashes
+#define DENSITY_HASH_BITS_MAXIMUM   16      // Largest dictionary, 65536 hashes
+#define DENSITY_HASH_BITS_DEFAULT   16
+
 typedef enum {
     DENSITY_ALGORITHM_CHAMELEON = 1,
     DENSITY_ALGORITHM_CHEETAH = 2,
@@ -72,13 +76,31 @@ typedef enum {
     DENSITY_STATE_ERROR_DURING_PROCESSING,                       // Error during processing
     DENSITY_STATE_ERROR_INVALID_CONTEXT,                         // Invalid context
     DENSITY_STATE_ERROR_INVALID_ALGORITHM,                       // Invalid algorithm
+    DENSITY_STATE_ERROR_INVALID_HASH_BITS,                       // Dictionary hash width out of range
+    DENSITY_STATE_ERROR_INVALID_HEADER,                          // Compressed data header is malformed or uses unknown features
+    DENSITY_STATE_ERROR_INVALID_DICTIONARY,                      // Dictionary image is corrupt or does not match the context or compressed data
+    DENSITY_STATE_ERROR_SESSION_OUT_OF_SYNC,                     // Session message is not the one the context expects next
+    DENSITY_STATE_STALL_ON_INPUT,                                // Streaming needs more input to go on
+    DENSITY_STATE_STALL_ON_OUTPUT,                               // Streaming needs more output space to go on
 } DENSITY_STATE;
 
 typedef struct {
     DENSITY_ALGORITHM algorithm;
+    uint8_t hash_bits;
     bool dictionary_type;
     size_t dictionary_size;
     void* dictionary;
+    void* dictionary_epochs;
+    bool dictionary_pages;
+    const void* dictionary_image;
+    uint_fast32_t dictionary_id;
+    bool dictionary_static;
+    void* dictionary_snapshot;
+    uint8_t header_flags;
+    uint_fast64_t content_size;
+    uint_fast32_t header_dictionary_id;
+    bool session_open;
+    uint_fast32_t session_sequence;
 } density_context;
 
 typedef struct {
@@ -88,6 +110,32 @@ typedef struct {
     density_context* context;
 } density_processing_result;
 
+typedef struct density_stream density_stream;
+
+typedef struct {
+    const uint8_t *input_buffer;
+    uint_fast64_t input_size;
+    uint8_t *output_buffer;
+    uint_fast64_t output_size;
+} density_batch_item;
+
+typedef struct {
+    void *buffer;
+    uint_fast64_t size;
+} density_iovec;
+
+typedef struct {
+    DENSITY_ALGORITHM algorithm;
+    uint8_t hash_bits;
+    bool content_size_known;
+    uint_fast64_t content_size;         // Decompressed size, 0 if unknown
+    uint_fast32_t block_size;           // Size of independent blocks, 0 if the data is not split in blocks
+    bool segmented;                     // Data was produced by a stream
+    uint_fast64_t header_size;          // Bytes preceding the compressed data, skipped metadata frames included
+    uint_fast32_t dictionary_id;        // Id of the pre-trained dictionary the data was compressed from, 0 if none
+    bool static_dictionary;             // The pre-trained dictionary was loaded with density_load_static_dictionary
+} density_frame_info;
+
 
 
 /***********************************************************************************************************************
@@ -126,6 +174,19 @@ DENSITY_WINDOWS_EXPORT uint8_t density_version_revision(void);
  */
 DENSITY_WINDOWS_EXPORT size_t density_get_dictionary_size(DENSITY_ALGORITHM algorithm);
 
+/*
+ * Return the required size of an algorithm's dictionary when hashes are hash_bits wide, or 0 if the algorithm or width is not supported
+ *
+ * @param algorithm the algorithm to use this dictionary for
+ * @param hash_bits the dictionary hash width, between DENSITY_HASH_BITS_MINIMUM and DENSITY_HASH_BITS_MAXIMUM
+ */
+DENSITY_WINDOWS_EXPORT size_t density_get_dictionary_size_with_hash_bits(DENSITY_ALGORITHM algorithm, const uint8_t hash_bits);
+
+/*
+ * Return the name of the instruction set the compression kernels were selected for on this CPU
+ */
+DENSITY_WINDOWS_EXPORT const char *density_get_instruction_set(void);
+
 /*
  * Return an output buffer byte size which guarantees enough space for encoding input_size bytes
  *
@@ -140,6 +201,46 @@ DENSITY_WINDOWS_EXPORT uint_fast64_t density_compress_safe_size(const uint_fast6
  */
 DENSITY_WINDOWS_EXPORT uint_fast64_t density_decompress_safe_size(const uint_fast64_t expected_decompressed_output_size);
 
+/*
+ * Read the header of compressed data without decompressing it, skipping any metadata frames in front of it.
+ * When the content size is known, density_decompress_safe_size(content_size) bytes of output are enough to decompress everything at once.
+ * Returns DENSITY_STATE_ERROR_INVALID_HEADER if the data uses features this version does not know.
+ *
+ * @param input_buffer a buffer of bytes
+ * @param input_size the size in bytes of input_buffer
+ * @param info the frame information to fill
+ */
+DENSITY_WINDOWS_EXPORT DENSITY_STATE density_get_frame_info(const uint8_t *input_buffer, const uint_fast64_t input_size, density_frame_info *const info);
+
+/*
+ * Return the byte size of a metadata frame holding metadata_size bytes
+ *
+ * @param metadata_size the size of the metadata
+ */
+DENSITY_WINDOWS_EXPORT uint_fast64_t density_metadata_frame_size(const uint_fast32_t metadata_size);
+
+/*
+ * Store metadata_size bytes of user metadata as a skippable frame in output_buffer.
+ * Such frames can be put in front of compressed data : every decompression function skips them.
+ *
+ * @param metadata a buffer of bytes
+ * @param metadata_size the size in bytes of metadata
+ * @param output_buffer a buffer of bytes
+ * @param output_size the size of output_buffer, must be at least density_metadata_frame_size(metadata_size)
+ */
+DENSITY_WINDOWS_EXPORT density_processing_result density_write_metadata_frame(const uint8_t *metadata, const uint_fast32_t metadata_size, uint8_t *output_buffer, const uint_fast64_t output_size);
+
+/*
+ * Read the metadata frame at the start of input_buffer. On success, bytesRead is the frame's size, so that the next frame starts at input_buffer + bytesRead.
+ * Returns DENSITY_STATE_ERROR_INVALID_HEADER if input_buffer does not start with a metadata frame.
+ *
+ * @param input_buffer a buffer of bytes
+ * @param input_size the size in bytes of input_buffer
+ * @param metadata set to the location of the metadata within input_buffer
+ * @param metadata_size set to the size in bytes of the metadata
+ */
+DENSITY_WINDOWS_EXPORT density_processing_result density_read_metadata_frame(const uint8_t *input_buffer, const uint_fast64_t input_size, const uint8_t **metadata, uint_fast32_t *metadata_size);
+
 /*
  * Releases a context from memory.
  *
@@ -148,6 +249,71 @@ DENSITY_WINDOWS_EXPORT uint_fast64_t density_decompress_safe_size(const uint_fas
  */
 DENSITY_WINDOWS_EXPORT void density_free_context(density_context *const context, void (*mem_free)(void *));
 
+/*
+ * Switch a context to lazy dictionary reset. Resetting the context then only advances a generation counter, and stale dictionary entries are zeroed on first use.
+ * Output remains identical to what a freshly zeroed dictionary produces, or to what the dictionary image produces for primed contexts.
+ *
+ * @param context the context to use
+ * @param mem_alloc the memory allocation function. If set to NULL, malloc() is used
+ */
+DENSITY_WINDOWS_EXPORT DENSITY_STATE density_enable_lazy_reset(density_context *const context, void *(*mem_alloc)(size_t));
+
+/*
+ * Reset a context's dictionary to its blank state, or to its dictionary image when primed, so that the context can process a new, independent stream.
+ * This is a single memset for regular contexts, a constant time operation for contexts using lazy dictionary reset, and nothing for contexts holding a static dictionary.
+ * Returns DENSITY_STATE_ERROR_INVALID_CONTEXT for contexts prepared with custom_dictionary set to true whose dictionary was not provided.
+ *
+ * @param context the context to reset
+ */
+DENSITY_WINDOWS_EXPORT DENSITY_STATE density_reset_context(density_context *const context);
+
+/*
+ * Save a copy of a context's dictionary as it stands, for density_context_restore to go back to. Taking a new snapshot replaces the previous one.
+ * The context is switched to lazy dictionary reset, so that restores only copy back the dictionary pages used since, and cost grows with
+ * the amount of data processed rather than with the dictionary size.
+ * Compression and decompression contexts going through the same data and snapshots stay in step : on the decoding side, prime the context with
+ * density_decompress_prepare_context and density_decompress_with_context, take the snapshot, then for each message call density_context_restore,
+ * density_decompress_read_frame_header and density_decompress_with_context, as the compressing side called density_context_restore before each message.
+ * Returns DENSITY_STATE_ERROR_INVALID_CONTEXT for contexts holding a static dictionary, which never changes.
+ *
+ * @param context the context to use
+ * @param mem_alloc the memory allocation function. If set to NULL, malloc() is used. Memory is released by density_free_context
+ */
+DENSITY_WINDOWS_EXPORT DENSITY_STATE density_context_snapshot(density_context *const context, void *(*mem_alloc)(size_t));
+
+/*
+ * Bring a context's dictionary back to its last snapshot, in constant time.
+ * Returns DENSITY_STATE_ERROR_INVALID_CONTEXT if no snapshot was taken.
+ *
+ * @param context the context to restore
+ */
+DENSITY_WINDOWS_EXPORT DENSITY_STATE density_context_restore(density_context *const context);
+
+/*
+ * Allocate size bytes of zeroed memory aligned on at least 64 bytes, backed by huge pages whenever the system provides them.
+ * Falls back to regular pages otherwise. Suitable for custom dictionaries or workspaces.
+ *
+ * @param size the number of bytes to allocate
+ */
+DENSITY_WINDOWS_EXPORT void *density_allocate_pages(const size_t size);
+
+/*
+ * Free memory allocated with density_allocate_pages
+ *
+ * @param pages the memory to free
+ * @param size the size which was requested when allocating
+ */
+DENSITY_WINDOWS_EXPORT void density_free_pages(void *const pages, const size_t size);
+
+/*
+ * Move a context's dictionary to memory allocated with density_allocate_pages, which reduces TLB misses on random dictionary accesses.
+ * The dictionary content is preserved. Contexts using a custom dictionary are not supported.
+ *
+ * @param context the context to use
+ * @param mem_free the memory freeing function used for the previous dictionary. If set to NULL, free() is used
+ */
+DENSITY_WINDOWS_EXPORT DENSITY_STATE density_enable_huge_pages(density_context *const context, void (*mem_free)(void *));
+
 /*
  * Allocate a context in memory using the provided function and optional dictionary
  *
@@ -157,6 +323,18 @@ DENSITY_WINDOWS_EXPORT void density_free_context(density_context *const context,
  */
 DENSITY_WINDOWS_EXPORT density_processing_result density_compress_prepare_context(const DENSITY_ALGORITHM algorithm, const bool custom_dictionary, void *(*mem_alloc)(size_t));
 
+/*
+ * Allocate a context in memory like density_compress_prepare_context does, with a dictionary of 1 << hash_bits hashes.
+ * Small widths keep the dictionary within the first cache levels and make resets cheaper, which suits small inputs, at some cost in ratio on larger ones.
+ * The width is recorded in the compressed data's header, and is picked up by every decompression function.
+ *
+ * @param algorithm the required algorithm
+ * @param hash_bits the dictionary hash width, between DENSITY_HASH_BITS_MINIMUM and DENSITY_HASH_BITS_MAXIMUM
+ * @param custom_dictionary use an eventual custom dictionary ? If set to true the context's dictionary will have to be allocated, its size is given by density_get_dictionary_size_with_hash_bits
+ * @param mem_alloc the memory allocation function. If set to NULL, malloc() is used
+ */
+DENSITY_WINDOWS_EXPORT density_processing_result density_compress_prepare_context_with_hash_bits(const DENSITY_ALGORITHM algorithm, const uint8_t hash_bits, const bool custom_dictionary, void *(*mem_alloc)(size_t));
+
 /*
  * Compress an input_buffer of input_size bytes and store the result in output_buffer, using the provided context.
  * Important note   * this function could be unsafe memory-wise if not used properly.
@@ -190,10 +368,24 @@ DENSITY_WINDOWS_EXPORT density_processing_result density_compress(const uint8_t
  */
 DENSITY_WINDOWS_EXPORT density_processing_result density_decompress_prepare_context(const uint8_t *input_buffer, const uint_fast64_t input_size, const bool custom_dictionary, void *(*mem_alloc)(size_t));
 
+/*
+ * Read the header of the next frame into an existing decompression context, so that density_decompress_with_context can decode the frame with it.
+ * The dictionary is left as it is : call density_reset_context or density_context_restore first, as the compressing side did before compressing the frame.
+ * Returns DENSITY_STATE_ERROR_INVALID_CONTEXT if the frame was compressed with another algorithm or hash width, bytesRead being the header size otherwise.
+ *
+ * @param input_buffer a buffer of bytes, starting with a frame
+ * @param input_size the size in bytes of input_buffer
+ * @param context the context to use
+ */
+DENSITY_WINDOWS_EXPORT density_processing_result density_decompress_read_frame_header(const uint8_t *input_buffer, const uint_fast64_t input_size, density_context *const context);
+
 /*
  * Decompress an input_buffer of input_size bytes and store the result in output_buffer, using the provided dictionary.
  * Important notes  * You must know in advance the algorithm used for compression to provide the proper dictionary.
  *                  * This function could be unsafe memory-wise if not used properly.
+ *                  * The data is described by the header last read with density_decompress_prepare_context or density_decompress_read_frame_header.
+ *                    Unless the frame is rejected before any of it is read, that header is used up : each following frame needs density_decompress_read_frame_header.
+ *                    Streams keep theirs, so that decoding can resume from any of their sync points.
  *
  * @param input_buffer a buffer of bytes
  * @param input_size the size in bytes of input_buffer
@@ -213,6 +405,413 @@ DENSITY_WINDOWS_EXPORT density_processing_result density_decompress_with_context
  */
 DENSITY_WINDOWS_EXPORT density_processing_result density_decompress(const uint8_t *input_buffer, const uint_fast64_t input_size, uint8_t *output_buffer, const uint_fast64_t output_size);
 
+/*
+ * Close a context's session, so that the next message it compresses opens a new one from a fresh dictionary,
+ * or so that it only decompresses continuation frames again once it has decompressed a session opening frame.
+ *
+ * @param context the context to use
+ */
+DENSITY_WINDOWS_EXPORT void density_reset_session(density_context *const context);
+
+/*
+ * Compress a message of a session : successive messages are compressed with the same dictionary, so that each one benefits from all those before it.
+ * The first message, or the first one after density_reset_session or after a failure, opens the session with a regular frame and a fresh dictionary
+ * (or the context's dictionary image), which density_decompress also decompresses. Each following message goes in a continuation frame,
+ * made of an 8 byte header holding the message's sequence number and size, then the compressed data.
+ * Every frame must be handed to density_decompress_session, in order, on the decompressing side.
+ *
+ * @param input_buffer the message
+ * @param input_size the size in bytes of input_buffer
+ * @param output_buffer a buffer of bytes, density_compress_safe_size(input_size) bytes are always enough
+ * @param output_size the size of output_buffer
+ * @param context a compression context, which a session ties to a single decompression context
+ */
+DENSITY_WINDOWS_EXPORT density_processing_result density_compress_session(const uint8_t *input_buffer, const uint_fast64_t input_size, uint8_t *output_buffer, const uint_fast64_t output_size, density_context *const context);
+
+/*
+ * Decompress a message of a session, compressed with density_compress_session. Session opening frames reset the context and can be decompressed at any time,
+ * continuation frames only in sequence : a lost, duplicated or reordered message returns DENSITY_STATE_ERROR_SESSION_OUT_OF_SYNC and leaves the context untouched,
+ * so that the expected message can still be supplied. Once decompression of a message fails otherwise, the session is closed and only an opening frame,
+ * which the compressing side sends after density_reset_session, resynchronizes it.
+ *
+ * @param input_buffer a whole frame
+ * @param input_size the size in bytes of input_buffer
+ * @param output_buffer a buffer of bytes
+ * @param output_size the size of output_buffer, density_decompress_safe_size(message size) bytes are always enough
+ * @param context a decompression context for the session's algorithm and hash width, with the same dictionary image if any
+ */
+DENSITY_WINDOWS_EXPORT density_processing_result density_decompress_session(const uint8_t *input_buffer, const uint_fast64_t input_size, uint8_t *output_buffer, const uint_fast64_t output_size, density_context *const context);
+
+/*
+ * Return the byte size of a dictionary image for the given algorithm and hash width, or 0 if either is invalid
+ *
+ * @param algorithm the algorithm
+ * @param hash_bits the dictionary hash width
+ */
+DENSITY_WINDOWS_EXPORT uint_fast64_t density_dictionary_image_size(const DENSITY_ALGORITHM algorithm, const uint8_t hash_bits);
+
+/*
+ * Build a pre-trained dictionary from sample data and store it as a dictionary image in image, which can be saved and loaded later on.
+ * Samples are compressed in order, so that the last ones weigh the most. Images carry a format version, a checksum and an id,
+ * and only load on machines sharing the byte order of the one which trained them.
+ *
+ * @param algorithm the algorithm the dictionary is for
+ * @param hash_bits the dictionary hash width, between DENSITY_HASH_BITS_MINIMUM and DENSITY_HASH_BITS_MAXIMUM
+ * @param samples an array of count sample buffers
+ * @param sample_sizes the size in bytes of each sample
+ * @param count the number of samples
+ * @param image a buffer of bytes
+ * @param image_size the size of image, must be at least density_dictionary_image_size(algorithm, hash_bits)
+ */
+DENSITY_WINDOWS_EXPORT density_processing_result density_train_dictionary(const DENSITY_ALGORITHM algorithm, const uint8_t hash_bits, const uint8_t *const *samples, const uint_fast64_t *sample_sizes, const uint_fast64_t count, uint8_t *image, const uint_fast64_t image_size);
+
+/*
+ * Return the id of a dictionary image, as found in density_frame_info for data compressed from it, or 0 if image is not a dictionary image
+ *
+ * @param image a dictionary image
+ * @param image_size the size in bytes of image
+ */
+DENSITY_WINDOWS_EXPORT uint_fast32_t density_dictionary_id(const uint8_t *image, const uint_fast64_t image_size);
+
+/*
+ * Prime a compression or decompression context with a dictionary image. The image's dictionary replaces the context's one,
+ * and density_reset_context restores it instead of a blank dictionary, so image must remain valid as long as the context uses it.
+ * Data compressed with a primed context records the dictionary id, and only decompresses with a context primed with the same image :
+ * other decompression functions return DENSITY_STATE_ERROR_INVALID_DICTIONARY.
+ * Returns DENSITY_STATE_ERROR_INVALID_DICTIONARY if the image is corrupt or does not match the context's algorithm and hash width,
+ * and DENSITY_STATE_ERROR_INVALID_CONTEXT if the context was prepared with custom_dictionary set to true and its dictionary was not provided.
+ *
+ * @param context the context to prime
+ * @param image a dictionary image, or NULL to go back to a blank dictionary
+ * @param image_size the size in bytes of image
+ */
+DENSITY_WINDOWS_EXPORT DENSITY_STATE density_load_dictionary(density_context *const context, const uint8_t *image, const uint_fast64_t image_size);
+
+/*
+ * Prime a compression or decompression context with a dictionary image used as a static dictionary : it is looked up but never updated,
+ * so any number of contexts, in any number of threads, can share a single image, for instance a memory-mapped file, without copying it.
+ * Contexts prepared with custom_dictionary set to true need no dictionary of their own. Every frame starts from the unchanged image,
+ * hence no reset is needed between independent frames. Ratio is lower than with density_load_dictionary on data unlike the samples.
+ * Static frames only decompress with a context holding the same image statically, otherwise DENSITY_STATE_ERROR_INVALID_DICTIONARY is returned,
+ * as it is for images which are corrupt, do not match the context's algorithm and hash width, or whose dictionary is not 4-byte aligned.
+ *
+ * @param context the context to prime
+ * @param image a dictionary image, which must remain valid and unmodified as long as the context uses it, or NULL to go back to a blank dictionary,
+ *              which needs the context to have a dictionary of its own
+ * @param image_size the size in bytes of image
+ */
+DENSITY_WINDOWS_EXPORT DENSITY_STATE density_load_static_dictionary(density_context *const context, const uint8_t *image, const uint_fast64_t image_size);
+
+/*
+ * Return the byte size of a workspace able to hold a context and dictionary for the given algorithm, or 0 if the algorithm is unknown
+ *
+ * @param algorithm the algorithm to use
+ */
+DENSITY_WINDOWS_EXPORT uint_fast64_t density_workspace_size(const DENSITY_ALGORITHM algorithm);
+
+/*
+ * Return the byte size of a workspace able to hold a context and dictionary for the given algorithm and hash width, or 0 if either is not supported
+ *
+ * @param algorithm the algorithm to use
+ * @param hash_bits the dictionary hash width, between DENSITY_HASH_BITS_MINIMUM and DENSITY_HASH_BITS_MAXIMUM
+ */
+DENSITY_WINDOWS_EXPORT uint_fast64_t density_workspace_size_with_hash_bits(const DENSITY_ALGORITHM algorithm, const uint8_t hash_bits);
+
+/*
+ * Compress an input_buffer of input_size bytes and store the result in output_buffer, like density_compress does.
+ * The context and a 64-byte aligned dictionary are carved out of the provided workspace, so no memory is allocated.
+ * They are kept in the workspace, so that later calls with the same algorithm and hash width only reset the dictionary pages they use :
+ * the workspace has to be left untouched between calls, or be zeroed before being used again. The returned result's context is always NULL.
+ *
+ * @param input_buffer a buffer of bytes
+ * @param input_size the size in bytes of input_buffer
+ * @param output_buffer a buffer of bytes
+ * @param output_size the size of output_buffer, must be at least DENSITY_MINIMUM_OUTPUT_BUFFER_SIZE
+ * @param algorithm the algorithm to use
+ * @param workspace a buffer of bytes, with no alignment requirement
+ * @param workspace_size the size of workspace, must be at least density_workspace_size(algorithm)
+ */
+DENSITY_WINDOWS_EXPORT density_processing_result density_compress_with_workspace(const uint8_t *input_buffer, const uint_fast64_t input_size, uint8_t *output_buffer, const uint_fast64_t output_size, const DENSITY_ALGORITHM algorithm, void *const workspace, const uint_fast64_t workspace_size);
+
+/*
+ * Compress an input_buffer of input_size bytes like density_compress_with_workspace does, with a dictionary of 1 << hash_bits hashes.
+ * See density_compress_prepare_context_with_hash_bits.
+ *
+ * @param input_buffer a buffer of bytes
+ * @param input_size the size in bytes of input_buffer
+ * @param output_buffer a buffer of bytes
+ * @param output_size the size of output_buffer, must be at least DENSITY_MINIMUM_OUTPUT_BUFFER_SIZE
+ * @param algorithm the algorithm to use
+ * @param hash_bits the dictionary hash width, between DENSITY_HASH_BITS_MINIMUM and DENSITY_HASH_BITS_MAXIMUM
+ * @param workspace a buffer of bytes, with no alignment requirement
+ * @param workspace_size the size of workspace, must be at least density_workspace_size_with_hash_bits(algorithm, hash_bits)
+ */
+DENSITY_WINDOWS_EXPORT density_processing_result density_compress_with_workspace_with_hash_bits(const uint8_t *input_buffer, const uint_fast64_t input_size, uint8_t *output_buffer, const uint_fast64_t output_size, const DENSITY_ALGORITHM algorithm, const uint8_t hash_bits, void *const workspace, const uint_fast64_t workspace_size);
+
+/*
+ * Decompress an input_buffer of input_size bytes and store the result in output_buffer, like density_decompress does.
+ * The context and a 64-byte aligned dictionary are carved out of the provided workspace, and kept there like density_compress_with_workspace does.
+ * The returned result's context is always NULL.
+ *
+ * @param input_buffer a buffer of bytes
+ * @param input_size the size in bytes of input_buffer
+ * @param output_buffer a buffer of bytes
+ * @param output_size the size of output_buffer, must be at least DENSITY_MINIMUM_OUTPUT_BUFFER_SIZE
+ * @param workspace a buffer of bytes, with no alignment requirement
+ * @param workspace_size the size of workspace, must be at least density_workspace_size_with_hash_bits(algorithm and hash width used for compression)
+ */
+DENSITY_WINDOWS_EXPORT density_processing_result density_decompress_with_workspace(const uint8_t *input_buffer, const uint_fast64_t input_size, uint8_t *output_buffer, const uint_fast64_t output_size, void *const workspace, const uint_fast64_t workspace_size);
+
+/*
+ * Compress an input_buffer of input_size bytes and store the result in output_buffer, like density_compress does.
+ * The context and dictionary are cached per thread, algorithm and hash width, and reused by subsequent calls, so that no memory is allocated once they exist.
+ * The returned result's context is always NULL.
+ *
+ * @param input_buffer a buffer of bytes
+ * @param input_size the size in bytes of input_buffer
+ * @param output_buffer a buffer of bytes
+ * @param output_size the size of output_buffer, must be at least DENSITY_MINIMUM_OUTPUT_BUFFER_SIZE
+ * @param algorithm the algorithm to use
+ */
+DENSITY_WINDOWS_EXPORT density_processing_result density_compress_cached(const uint8_t *input_buffer, const uint_fast64_t input_size, uint8_t *output_buffer, const uint_fast64_t output_size, const DENSITY_ALGORITHM algorithm);
+
+/*
+ * Decompress an input_buffer of input_size bytes and store the result in output_buffer, like density_decompress does.
+ * The context and dictionary are cached per thread, algorithm and hash width, and reused by subsequent calls, so that no memory is allocated once they exist.
+ * The returned result's context is always NULL.
+ *
+ * @param input_buffer a buffer of bytes
+ * @param input_size the size in bytes of input_buffer
+ * @param output_buffer a buffer of bytes
+ * @param output_size the size of output_buffer, must be at least DENSITY_MINIMUM_OUTPUT_BUFFER_SIZE
+ */
+DENSITY_WINDOWS_EXPORT density_processing_result density_decompress_cached(const uint8_t *input_buffer, const uint_fast64_t input_size, uint8_t *output_buffer, const uint_fast64_t output_size);
+
+/*
+ * Free the contexts cached by density_compress_cached and density_decompress_cached for the calling thread.
+ * Must be called by every thread using these functions before it exits, otherwise their memory is leaked.
+ */
+DENSITY_WINDOWS_EXPORT void density_free_cached_contexts(void);
+
+/*
+ * Compress count independent buffers, described by items, in one call. Every item is compressed like density_compress does,
+ * and its result stored at the same position in results.
+ * All items share the dictionary cached for the calling thread, which is reset cheaply between them, so that small items cost little more than their encoding.
+ * density_free_cached_contexts has to be called before the thread exits.
+ * Returns DENSITY_STATE_OK if every item was compressed, otherwise the state of the first item which failed, the following items being processed anyway.
+ *
+ * @param items the buffers to compress, each output_size being at least density_compress_safe_size(input_size)
+ * @param count the number of items
+ * @param algorithm the algorithm to use
+ * @param results an array of count results
+ */
+DENSITY_WINDOWS_EXPORT DENSITY_STATE density_compress_batch(const density_batch_item *items, const uint_fast64_t count, const DENSITY_ALGORITHM algorithm, density_processing_result *results);
+
+/*
+ * Decompress count independent buffers, described by items, in one call. Every item is decompressed like density_decompress_cached does,
+ * and its result stored at the same position in results.
+ * density_free_cached_contexts has to be called before the thread exits.
+ * Returns DENSITY_STATE_OK if every item was decompressed, otherwise the state of the first item which failed, the following items being processed anyway.
+ *
+ * @param items the buffers to decompress, each output_size being at least density_decompress_safe_size(original size)
+ * @param count the number of items
+ * @param results an array of count results
+ */
+DENSITY_WINDOWS_EXPORT DENSITY_STATE density_decompress_batch(const density_batch_item *items, const uint_fast64_t count, density_processing_result *results);
+
+/*
+ * Return an output buffer byte size which guarantees enough space for encoding input_size bytes, spread over input_count elements, with density_compressv
+ *
+ * @param input_size the total size of the input data which is about to be compressed
+ * @param input_count the number of elements holding it
+ */
+DENSITY_WINDOWS_EXPORT uint_fast64_t density_compressv_safe_size(const uint_fast64_t input_size, const uint_fast64_t input_count);
+
+/*
+ * Compress the data held by a chain of buffers, as if they were a single contiguous one, and store the result in output_buffer.
+ * Elements are encoded where they lie, as segments sharing the same dictionary, only the last density_decompress_safe_size(0) bytes of each element and the
+ * smallest elements being gathered into a staging buffer. Every call encodes an independent frame from a fresh dictionary, which density_decompress also decompresses.
+ * Returns DENSITY_STATE_ERROR_INVALID_DICTIONARY for contexts holding a dictionary image.
+ *
+ * @param input the elements to compress, in order, whose buffers are only read
+ * @param input_count the number of elements
+ * @param output_buffer a buffer of bytes
+ * @param output_size the size of output_buffer, density_compressv_safe_size(total input size, input_count) bytes are always enough
+ * @param context a compression context
+ */
+DENSITY_WINDOWS_EXPORT density_processing_result density_compressv(const density_iovec *input, const uint_fast64_t input_count, uint8_t *output_buffer, const uint_fast64_t output_size, density_context *const context);
+
+/*
+ * Decompress a whole frame into a chain of buffers, which are filled in order as if they were a single contiguous one.
+ * Segments of frames written by density_compressv or by a stream are decoded in place whenever their element has density_decompress_safe_size(segment size) bytes left,
+ * the others go through a scratch buffer. Frames which are not segmented are decoded in a temporary buffer first.
+ *
+ * @param input_buffer a whole frame
+ * @param input_size the size in bytes of input_buffer
+ * @param output the elements to fill, whose total size must be at least the decompressed size
+ * @param output_count the number of elements
+ * @param context a decompression context for the frame's algorithm and hash width, with the same dictionary image if any
+ */
+DENSITY_WINDOWS_EXPORT density_processing_result density_decompressv(const uint8_t *input_buffer, const uint_fast64_t input_size, const density_iovec *output, const uint_fast64_t output_count, density_context *const context);
+
+/*
+ * Return an output buffer byte size which guarantees enough space for encoding input_size bytes with density_compress_parallel
+ *
+ * @param input_size the size of the input data which is about to be compressed
+ * @param block_size the block size which will be used for compression. If set to 0, a default block size is used
+ */
+DENSITY_WINDOWS_EXPORT uint_fast64_t density_compress_parallel_safe_size(const uint_fast64_t input_size, const uint_fast32_t block_size);
+
+/*
+ * Compress an input_buffer of input_size bytes as a frame of independent blocks, using multiple threads, and store the result in output_buffer.
+ * Every block is encoded with its own state and dictionary, and the frame starts with an index of each block's compressed size.
+ * The resulting frame can be decompressed with density_decompress.
+ * Each thread encodes a run of consecutive blocks, or two halves of it in lockstep when the algorithm's kernel allows it.
+ * Runs are staged at their worst case offset in output_buffer then moved behind the previous ones, the first one being in place.
+ * The last run only needs the room it takes, so that an output_buffer smaller than density_compress_parallel_safe_size is accepted as long as the frame fits,
+ * DENSITY_STATE_ERROR_OUTPUT_BUFFER_TOO_SMALL being returned otherwise.
+ *
+ * @param input_buffer a buffer of bytes
+ * @param input_size the size in bytes of input_buffer
+ * @param output_buffer a buffer of bytes
+ * @param output_size the size of output_buffer, density_compress_parallel_safe_size(input_size, block_size) always being enough
+ * @param algorithm the algorithm to use
+ * @param block_size the uncompressed size of each block. If set to 0, a default block size is used
+ * @param threads the maximum number of threads to use. If set to 0, one thread per available processor is used
+ */
+DENSITY_WINDOWS_EXPORT density_processing_result density_compress_parallel(const uint8_t *input_buffer, const uint_fast64_t input_size, uint8_t *output_buffer, const uint_fast64_t output_size, const DENSITY_ALGORITHM algorithm, const uint_fast32_t block_size, const uint_fast16_t threads);
+
+/*
+ * Compress an input_buffer of input_size bytes like density_compress_parallel does, every block's dictionary having 1 << hash_bits hashes.
+ * See density_compress_prepare_context_with_hash_bits.
+ *
+ * @param input_buffer a buffer of bytes
+ * @param input_size the size in bytes of input_buffer
+ * @param output_buffer a buffer of bytes
+ * @param output_size the size of output_buffer, see density_compress_parallel
+ * @param algorithm the algorithm to use
+ * @param hash_bits the dictionary hash width, between DENSITY_HASH_BITS_MINIMUM and DENSITY_HASH_BITS_MAXIMUM
+ * @param block_size the uncompressed size of each block. If set to 0, a default block size is used
+ * @param threads the maximum number of threads to use. If set to 0, one thread per available processor is used
+ */
+DENSITY_WINDOWS_EXPORT density_processing_result density_compress_parallel_with_hash_bits(const uint8_t *input_buffer, const uint_fast64_t input_size, uint8_t *output_buffer, const uint_fast64_t output_size, const DENSITY_ALGORITHM algorithm, const uint8_t hash_bits, const uint_fast32_t block_size, const uint_fast16_t threads);
+
+/*
+ * Decompress an input_buffer of input_size bytes and store the result in output_buffer, using multiple threads.
+ * Frames produced by density_compress_parallel are decoded block by block, every block being decoded in place in output_buffer, without writing past its end.
+ * Streams with sync points (see density_stream_set_sync_interval) are decoded the same way, one run of segments between sync points at a time.
+ * Any other compressed data is decompressed like density_decompress does.
+ *
+ * @param input_buffer a buffer of bytes
+ * @param input_size the size in bytes of input_buffer
+ * @param output_buffer a buffer of bytes
+ * @param output_size the size of output_buffer, must be at least density_decompress_safe_size(original size)
+ * @param threads the maximum number of threads to use. If set to 0, one thread per available processor is used
+ */
+DENSITY_WINDOWS_EXPORT density_processing_result density_decompress_parallel(const uint8_t *input_buffer, const uint_fast64_t input_size, uint8_t *output_buffer, const uint_fast64_t output_size, const uint_fast16_t threads);
+
+/*
+ * Decompress length bytes starting at offset in the original data, out of a frame produced by density_compress_parallel.
+ * Only the blocks covering the range are decoded, so small blocks make for cheap random access, at some cost in ratio.
+ * The first of them is located by summing the index entries in front of it, which takes time linear in offset / block size.
+ * The range is clipped to the original data's size, bytesWritten telling how many bytes were stored in output_buffer.
+ * Contexts are cached per thread like density_decompress_cached does, so density_free_cached_contexts has to be called before the thread exits.
+ * Returns DENSITY_STATE_ERROR_INVALID_HEADER if the compressed data is not split in blocks.
+ *
+ * @param input_buffer a buffer of bytes
+ * @param input_size the size in bytes of input_buffer
+ * @param offset the position of the range in the original data
+ * @param length the size in bytes of the range
+ * @param output_buffer a buffer of bytes
+ * @param output_size the size of output_buffer, must be at least length
+ */
+DENSITY_WINDOWS_EXPORT density_processing_result density_decompress_range(const uint8_t *input_buffer, const uint_fast64_t input_size, const uint_fast64_t offset, const uint_fast64_t length, uint8_t *output_buffer, const uint_fast64_t output_size);
+
+/*
+ * Prepare a stream to compress data provided in chunks of any size, using a bounded amount of memory.
+ * The data is encoded as a sequence of segments sharing the same dictionary and algorithm state, and the result can also be decompressed with density_decompress.
+ * Returns NULL if the algorithm is not supported.
+ *
+ * @param algorithm the algorithm to use
+ * @param mem_alloc the memory allocation function. If set to NULL, malloc is used
+ */
+DENSITY_WINDOWS_EXPORT density_stream *density_stream_prepare_compression(const DENSITY_ALGORITHM algorithm, void *(*mem_alloc)(size_t));
+
+/*
+ * Make a stream insert a sync point every interval bytes of input, rounded up to a whole number of 64 KB segments.
+ * Dictionary and algorithm state start over at every sync point, so that density_decompress_parallel can decode the stream on multiple threads,
+ * and decoding can start from any sync point (see density_find_sync_point). Shorter intervals cost more in ratio.
+ * Must be called before any data is provided to the stream. An interval of 0 disables sync points, which is the default.
+ *
+ * @param stream a stream prepared with density_stream_prepare_compression
+ * @param interval the number of input bytes between sync points
+ */
+DENSITY_WINDOWS_EXPORT DENSITY_STATE density_stream_set_sync_interval(density_stream *const stream, const uint_fast64_t interval);
+
+/*
+ * Return the offset of the first sync point in input_buffer, or input_size if there is none.
+ * Decompression can resume there : prepare a context with density_decompress_prepare_context on the start of the stream,
+ * then call density_decompress_with_context on the data starting at the sync point, which yields the original data following it.
+ * Candidates are checked against the segments which follow them, but incompressible data copied as is can still mimic a sync point :
+ * should decompression fail from the returned offset, search again from the byte after it.
+ *
+ * @param input_buffer a buffer of bytes, which can be any part of a stream
+ * @param input_size the size in bytes of input_buffer
+ */
+DENSITY_WINDOWS_EXPORT uint_fast64_t density_find_sync_point(const uint8_t *input_buffer, const uint_fast64_t input_size);
+
+/*
+ * Compress the next input_size bytes of a stream into output_buffer.
+ * Returns DENSITY_STATE_OK once all input has been consumed, part of it possibly being kept for the next call.
+ * Returns DENSITY_STATE_STALL_ON_OUTPUT when output_buffer is full : the call has to be repeated with more output space and the input left unread (bytesRead tells how much was consumed).
+ *
+ * @param stream a stream prepared with density_stream_prepare_compression
+ * @param input_buffer a buffer of bytes
+ * @param input_size the size in bytes of input_buffer
+ * @param output_buffer a buffer of bytes
+ * @param output_size the size of output_buffer, which can be any value
+ */
+DENSITY_WINDOWS_EXPORT density_processing_result density_stream_compress_continue(density_stream *const stream, const uint8_t *input_buffer, const uint_fast64_t input_size, uint8_t *output_buffer, const uint_fast64_t output_size);
+
+/*
+ * Compress the input kept by previous calls and write the end of the stream into output_buffer.
+ * Returns DENSITY_STATE_STALL_ON_OUTPUT when output_buffer is full, in which case the call has to be repeated with more output space.
+ *
+ * @param stream a stream prepared with density_stream_prepare_compression
+ * @param output_buffer a buffer of bytes
+ * @param output_size the size of output_buffer, which can be any value
+ */
+DENSITY_WINDOWS_EXPORT density_processing_result density_stream_compress_finish(density_stream *const stream, uint8_t *output_buffer, const uint_fast64_t output_size);
+
+/*
+ * Prepare a stream to decompress data produced by the streaming compression functions, provided in chunks of any size.
+ *
+ * @param mem_alloc the memory allocation function. If set to NULL, malloc is used
+ */
+DENSITY_WINDOWS_EXPORT density_stream *density_stream_prepare_decompression(void *(*mem_alloc)(size_t));
+
+/*
+ * Decompress the next input_size bytes of a stream into output_buffer.
+ * Returns DENSITY_STATE_OK once the end of the stream has been reached and all of its data written.
+ * Returns DENSITY_STATE_STALL_ON_INPUT when all input has been consumed before the end of the stream.
+ * Returns DENSITY_STATE_STALL_ON_OUTPUT when output_buffer is full : the call has to be repeated with more output space and the input left unread (bytesRead tells how much was consumed).
+ *
+ * @param stream a stream prepared with density_stream_prepare_decompression
+ * @param input_buffer a buffer of bytes
+ * @param input_size the size in bytes of input_buffer
+ * @param output_buffer a buffer of bytes
+ * @param output_size the size of output_buffer, which can be any value
+ */
+DENSITY_WINDOWS_EXPORT density_processing_result density_stream_decompress_continue(density_stream *const stream, const uint8_t *input_buffer, const uint_fast64_t input_size, uint8_t *output_buffer, const uint_fast64_t output_size);
+
+/*
+ * Free the memory held by a stream
+ *
+ * @param stream the stream to free, can be NULL
+ * @param mem_free the memory freeing function. If set to NULL, free is used
+ */
+DENSITY_WINDOWS_EXPORT void density_stream_free(density_stream *const stream, void (*mem_free)(void *));
+
 #ifdef __cplusplus
 }
 #endif
@@ -95,6 +95,27 @@ DENSITY_FORCE_INLINE uint_fast8_t density_msvc_ctz(uint64_t value) {
 #error Unsupported compiler
 #endif
 
+/*
+ * Kernels are built once per instruction set and picked at load time, unless the build already targets a specific CPU
+ */
+#if (defined(__clang__) || defined(__GNUC__)) && (defined(__x86_64__) || defined(__i386__)) && !defined(__SSE4_2__) && !defined(DENSITY_NO_DISPATCH)
+#define DENSITY_DISPATCH
+#define DENSITY_TARGET_SSE4_2       __attribute__((target("sse4.2,popcnt")))
+#define DENSITY_TARGET_AVX2         __attribute__((target("sse4.2,popcnt,avx2,bmi,bmi2,lzcnt,fma")))
+#define DENSITY_TARGET_AVX512       __attribute__((target("sse4.2,popcnt,avx2,bmi,bmi2,lzcnt,fma,avx512f,avx512bw,avx512vl,avx512dq")))
+#endif
+
+/*
+ * AVX2 code paths, either built for the target CPU or reached through dispatch
+ */
+#if defined(DENSITY_DISPATCH) || defined(__AVX2__)
+#define DENSITY_AVX2
+#include <immintrin.h>
+#ifndef DENSITY_DISPATCH
+#define DENSITY_TARGET_AVX2
+#endif
+#endif
+
 #ifdef DENSITY_LITTLE_ENDIAN
 #define DENSITY_LITTLE_ENDIAN_64(b)   ((uint64_t)b)
 #define DENSITY_LITTLE_ENDIAN_32(b)   ((uint32_t)b)
@@ -224,8 +245,8 @@ DENSITY_WINDOWS_EXPORT uint8_t density_version_revision();
  **********************************************************************************************************************/
 
 #define DENSITY_MAJOR_VERSION   0
-#define DENSITY_MINOR_VERSION   14
-#define DENSITY_REVISION        2
+#define DENSITY_MINOR_VERSION   15
+#define DENSITY_REVISION        0
 
 
 
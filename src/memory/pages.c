@@ -0,0 +1,98 @@
+/*
+ * Centaurean Density
+ *
+ * Copyright (c) 2013, Guillaume Voirin
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     1. Redistributions of source code must retain the above copyright notice, this
+ *        list of conditions and the following disclaimer.
+ *
+ *     2. Redistributions in binary form must reproduce the above copyright notice,
+ *        this list of conditions and the following disclaimer in the documentation
+ *        and/or other materials provided with the distribution.
+ *
+ *     3. Neither the name of the copyright holder nor the names of its
+ *        contributors may be used to endorse or promote products derived from
+ *        this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * 17/10/26 05:17
+ */
+
+#if !defined(_WIN64) && !defined(_WIN32)
+#define _DEFAULT_SOURCE
+#endif
+
+#include "pages.h"
+
+#if defined(_WIN64) || defined(_WIN32)
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#endif
+
+DENSITY_FORCE_INLINE size_t density_pages_round(const size_t size, const size_t page_size) {
+    return (size + page_size - 1) & ~(page_size - 1);
+}
+
+#if defined(_WIN64) || defined(_WIN32)
+DENSITY_WINDOWS_EXPORT void *density_allocate_pages(const size_t size) {
+    // Large pages require the "Lock pages in memory" privilege, regular pages are used otherwise
+    const size_t large_page_size = GetLargePageMinimum();
+    if (large_page_size) {
+        void *const pages = VirtualAlloc(NULL, density_pages_round(size, large_page_size), MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
+        if (pages != NULL)
+            return pages;
+    }
+    return VirtualAlloc(NULL, size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+}
+
+DENSITY_WINDOWS_EXPORT void density_free_pages(void *const pages, const size_t size) {
+    (void) size;
+    if (pages != NULL)
+        VirtualFree(pages, 0, MEM_RELEASE);
+}
+#else
+DENSITY_WINDOWS_EXPORT void *density_allocate_pages(const size_t size) {
+    const size_t mapping_size = density_pages_round(size, DENSITY_PAGES_HUGE_SIZE);
+
+#ifdef MAP_HUGETLB
+    // Explicit huge pages, only available if the system reserved some
+    void *const huge_pages = mmap(NULL, mapping_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (huge_pages != MAP_FAILED)
+        return huge_pages;
+#endif
+
+    // Otherwise map a huge page aligned range, so that transparent huge pages can back it
+    uint8_t *const mapping = mmap(NULL, mapping_size + DENSITY_PAGES_HUGE_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mapping == MAP_FAILED)
+        return NULL;
+    uint8_t *const pages = (uint8_t *) density_pages_round((size_t) mapping, DENSITY_PAGES_HUGE_SIZE);
+    if (pages != mapping)
+        munmap(mapping, (size_t) (pages - mapping));
+    if (pages != mapping + DENSITY_PAGES_HUGE_SIZE)
+        munmap(pages + mapping_size, (size_t) (mapping + DENSITY_PAGES_HUGE_SIZE - pages));
+#ifdef MADV_HUGEPAGE
+    madvise(pages, mapping_size, MADV_HUGEPAGE);
+#endif
+    return pages;
+}
+
+DENSITY_WINDOWS_EXPORT void density_free_pages(void *const pages, const size_t size) {
+    if (pages != NULL)
+        munmap(pages, density_pages_round(size, DENSITY_PAGES_HUGE_SIZE));
+}
+#endif
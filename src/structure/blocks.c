@@ -0,0 +1,77 @@
+/*
+ * Centaurean Density
+ *
+ * Copyright (c) 2013, Guillaume Voirin
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     1. Redistributions of source code must retain the above copyright notice, this
+ *        list of conditions and the following disclaimer.
+ *
+ *     2. Redistributions in binary form must reproduce the above copyright notice,
+ *        this list of conditions and the following disclaimer in the documentation
+ *        and/or other materials provided with the distribution.
+ *
+ *     3. Neither the name of the copyright holder nor the names of its
+ *        contributors may be used to endorse or promote products derived from
+ *        this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * 17/10/26 04:06
+ */
+
+#include "blocks.h"
+
+DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE void density_blocks_descriptor_read(const uint8_t **DENSITY_RESTRICT in, density_blocks_descriptor *DENSITY_RESTRICT descriptor) {
+    uint64_t content_size;
+    uint32_t block_size;
+    DENSITY_MEMCPY(&content_size, *in, sizeof(uint64_t));
+    DENSITY_MEMCPY(&block_size, *in + sizeof(uint64_t), sizeof(uint32_t));
+    descriptor->content_size = DENSITY_LITTLE_ENDIAN_64(content_size);
+    descriptor->block_size = DENSITY_LITTLE_ENDIAN_32(block_size);
+    descriptor->reserved = 0;
+
+    *in += sizeof(density_blocks_descriptor);
+}
+
+DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE void density_blocks_descriptor_write(uint8_t **DENSITY_RESTRICT out, const uint_fast64_t content_size, const uint_fast32_t block_size) {
+    const uint64_t endian_content_size = DENSITY_LITTLE_ENDIAN_64((uint64_t) content_size);
+    const uint32_t endian_block_size = DENSITY_LITTLE_ENDIAN_32((uint32_t) block_size);
+    DENSITY_MEMCPY(*out, &endian_content_size, sizeof(uint64_t));
+    DENSITY_MEMCPY(*out + sizeof(uint64_t), &endian_block_size, sizeof(uint32_t));
+    DENSITY_MEMSET(*out + sizeof(uint64_t) + sizeof(uint32_t), 0, sizeof(uint32_t));
+
+    *out += sizeof(density_blocks_descriptor);
+}
+
+DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE uint_fast64_t density_blocks_count(const uint_fast64_t content_size, const uint_fast64_t block_size) {
+    return (content_size + block_size - 1) / block_size;
+}
+
+DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE uint_fast64_t density_blocks_decompressed_size(const density_blocks_descriptor *const descriptor, const uint_fast64_t block) {
+    const uint_fast64_t remaining = descriptor->content_size - block * descriptor->block_size;
+    return remaining < descriptor->block_size ? remaining : descriptor->block_size;
+}
+
+DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE uint_fast32_t density_blocks_index_read(const uint8_t *const index, const uint_fast64_t block) {
+    density_blocks_index_entry entry;
+    DENSITY_MEMCPY(&entry, index + block * sizeof(density_blocks_index_entry), sizeof(density_blocks_index_entry));
+    return DENSITY_LITTLE_ENDIAN_32(entry);
+}
+
+DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE void density_blocks_index_write(uint8_t *const index, const uint_fast64_t block, const uint_fast32_t compressed_size) {
+    const density_blocks_index_entry entry = DENSITY_LITTLE_ENDIAN_32((density_blocks_index_entry) compressed_size);
+    DENSITY_MEMCPY(index + block * sizeof(density_blocks_index_entry), &entry, sizeof(density_blocks_index_entry));
+}
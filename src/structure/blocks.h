@@ -0,0 +1,69 @@
+/*
+ * Centaurean Density
+ *
+ * Copyright (c) 2013, Guillaume Voirin
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     1. Redistributions of source code must retain the above copyright notice, this
+ *        list of conditions and the following disclaimer.
+ *
+ *     2. Redistributions in binary form must reproduce the above copyright notice,
+ *        this list of conditions and the following disclaimer in the documentation
+ *        and/or other materials provided with the distribution.
+ *
+ *     3. Neither the name of the copyright holder nor the names of its
+ *        contributors may be used to endorse or promote products derived from
+ *        this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * 17/10/26 04:06
+ */
+
+#ifndef DENSITY_BLOCKS_H
+#define DENSITY_BLOCKS_H
+
+#include "../globals.h"
+#include "../density_api.h"
+
+#define DENSITY_BLOCKS_MINIMUM_SIZE             (1 << 12)
+#define DENSITY_BLOCKS_DEFAULT_SIZE             (1 << 22)
+#define DENSITY_BLOCKS_MAXIMUM_SIZE             (1 << 30)
+
+/*
+ * A block frame follows the main header when DENSITY_HEADER_FLAG_BLOCKS is set :
+ * the descriptor, then one index entry per block holding its compressed size, then the blocks themselves.
+ * Every block is an independent stream encoded with a fresh dictionary, so blocks can be processed in any order.
+ */
+
+#pragma pack(push)
+#pragma pack(4)
+typedef struct {
+    uint64_t content_size;
+    uint32_t block_size;
+    uint32_t reserved;
+} density_blocks_descriptor;
+#pragma pack(pop)
+
+typedef uint32_t density_blocks_index_entry;
+
+DENSITY_WINDOWS_EXPORT void density_blocks_descriptor_read(const uint8_t ** DENSITY_RESTRICT_DECLARE, density_blocks_descriptor * DENSITY_RESTRICT_DECLARE);
+DENSITY_WINDOWS_EXPORT void density_blocks_descriptor_write(uint8_t ** DENSITY_RESTRICT_DECLARE, const uint_fast64_t, const uint_fast32_t);
+DENSITY_WINDOWS_EXPORT uint_fast64_t density_blocks_count(const uint_fast64_t, const uint_fast64_t);
+DENSITY_WINDOWS_EXPORT uint_fast64_t density_blocks_decompressed_size(const density_blocks_descriptor *const, const uint_fast64_t);
+DENSITY_WINDOWS_EXPORT uint_fast32_t density_blocks_index_read(const uint8_t *const, const uint_fast64_t);
+DENSITY_WINDOWS_EXPORT void density_blocks_index_write(uint8_t *const, const uint_fast64_t, const uint_fast32_t);
+
+#endif
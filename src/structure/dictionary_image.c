@@ -0,0 +1,85 @@
+/*
+ * Centaurean Density
+ *
+ * Copyright (c) 2013, Guillaume Voirin
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     1. Redistributions of source code must retain the above copyright notice, this
+ *        list of conditions and the following disclaimer.
+ *
+ *     2. Redistributions in binary form must reproduce the above copyright notice,
+ *        this list of conditions and the following disclaimer in the documentation
+ *        and/or other materials provided with the distribution.
+ *
+ *     3. Neither the name of the copyright holder nor the names of its
+ *        contributors may be used to endorse or promote products derived from
+ *        this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * 17/10/26 10:58
+ */
+
+#include "dictionary_image.h"
+
+DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE void density_dictionary_header_read(const uint8_t **DENSITY_RESTRICT in, density_dictionary_header *DENSITY_RESTRICT header) {
+    uint32_t magic;
+    uint32_t id;
+    uint32_t size;
+    DENSITY_MEMCPY(&magic, *in, sizeof(uint32_t));
+    header->format_version = *(*in + 4);
+    header->algorithm = *(*in + 5);
+    header->hash_bits = *(*in + 6);
+    header->byte_order = *(*in + 7);
+    DENSITY_MEMCPY(&id, *in + 8, sizeof(uint32_t));
+    DENSITY_MEMCPY(&size, *in + 12, sizeof(uint32_t));
+    header->magic = DENSITY_LITTLE_ENDIAN_32(magic);
+    header->id = DENSITY_LITTLE_ENDIAN_32(id);
+    header->size = DENSITY_LITTLE_ENDIAN_32(size);
+
+    *in += sizeof(density_dictionary_header);
+}
+
+DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE void density_dictionary_header_write(uint8_t **DENSITY_RESTRICT out, const DENSITY_ALGORITHM algorithm, const uint8_t hash_bits, const uint_fast32_t id, const uint_fast32_t size) {
+    const uint32_t endian_magic = DENSITY_LITTLE_ENDIAN_32((uint32_t) DENSITY_DICTIONARY_MAGIC);
+    const uint32_t endian_id = DENSITY_LITTLE_ENDIAN_32((uint32_t) id);
+    const uint32_t endian_size = DENSITY_LITTLE_ENDIAN_32((uint32_t) size);
+    DENSITY_MEMCPY(*out, &endian_magic, sizeof(uint32_t));
+    *(*out + 4) = DENSITY_DICTIONARY_FORMAT_VERSION;
+    *(*out + 5) = (uint8_t) algorithm;
+    *(*out + 6) = hash_bits;
+    *(*out + 7) = DENSITY_DICTIONARY_BYTE_ORDER;
+    DENSITY_MEMCPY(*out + 8, &endian_id, sizeof(uint32_t));
+    DENSITY_MEMCPY(*out + 12, &endian_size, sizeof(uint32_t));
+
+    *out += sizeof(density_dictionary_header);
+}
+
+DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE uint_fast32_t density_dictionary_checksum(const DENSITY_ALGORITHM algorithm, const uint8_t hash_bits, const uint8_t *dictionary, const uint_fast64_t size) {
+    uint64_t hash = 0x9e3779b97f4a7c15llu ^ (((uint64_t) algorithm << 8) | hash_bits);
+    uint_fast64_t offset = 0;
+    for (; offset + sizeof(uint64_t) <= size; offset += sizeof(uint64_t)) {
+        uint64_t word;
+        DENSITY_MEMCPY(&word, dictionary + offset, sizeof(uint64_t));
+        hash = (hash ^ DENSITY_LITTLE_ENDIAN_64(word)) * 0xff51afd7ed558ccdllu;
+        hash ^= hash >> 29;
+    }
+    for (; offset < size; offset++)
+        hash = (hash ^ dictionary[offset]) * 0xff51afd7ed558ccdllu;
+    hash ^= hash >> 32;
+
+    // 0 stands for no dictionary in frame information
+    return (uint32_t) hash ? (uint32_t) hash : 1;
+}
@@ -0,0 +1,73 @@
+/*
+ * Centaurean Density
+ *
+ * Copyright (c) 2013, Guillaume Voirin
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     1. Redistributions of source code must retain the above copyright notice, this
+ *        list of conditions and the following disclaimer.
+ *
+ *     2. Redistributions in binary form must reproduce the above copyright notice,
+ *        this list of conditions and the following disclaimer in the documentation
+ *        and/or other materials provided with the distribution.
+ *
+ *     3. Neither the name of the copyright holder nor the names of its
+ *        contributors may be used to endorse or promote products derived from
+ *        this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * 17/10/26 10:58
+ */
+
+#ifndef DENSITY_DICTIONARY_IMAGE_H
+#define DENSITY_DICTIONARY_IMAGE_H
+
+#include "../globals.h"
+#include "../density_api.h"
+
+#define DENSITY_DICTIONARY_MAGIC                0x44534e44      // "DNSD"
+#define DENSITY_DICTIONARY_FORMAT_VERSION       1
+
+#ifdef DENSITY_LITTLE_ENDIAN
+#define DENSITY_DICTIONARY_BYTE_ORDER           0x1
+#else
+#define DENSITY_DICTIONARY_BYTE_ORDER           0x2
+#endif
+
+/*
+ * A dictionary image is a dictionary header followed by the raw dictionary of its algorithm and hash width.
+ * The dictionary is stored in the byte order of the machine which trained it, so images only load on machines sharing it.
+ * The dictionary id checksums the algorithm, the hash width and the dictionary, it never is 0.
+ */
+
+#pragma pack(push)
+#pragma pack(4)
+typedef struct {
+    uint32_t magic;
+    uint8_t format_version;
+    uint8_t algorithm;
+    uint8_t hash_bits;
+    uint8_t byte_order;
+    uint32_t id;
+    uint32_t size;
+} density_dictionary_header;
+#pragma pack(pop)
+
+DENSITY_WINDOWS_EXPORT void density_dictionary_header_read(const uint8_t ** DENSITY_RESTRICT_DECLARE, density_dictionary_header * DENSITY_RESTRICT_DECLARE);
+DENSITY_WINDOWS_EXPORT void density_dictionary_header_write(uint8_t ** DENSITY_RESTRICT_DECLARE, const DENSITY_ALGORITHM, const uint8_t, const uint_fast32_t, const uint_fast32_t);
+DENSITY_WINDOWS_EXPORT uint_fast32_t density_dictionary_checksum(const DENSITY_ALGORITHM, const uint8_t, const uint8_t *, const uint_fast64_t);
+
+#endif
@@ -0,0 +1,127 @@
+/*
+ * Centaurean Density
+ *
+ * Copyright (c) 2013, Guillaume Voirin
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     1. Redistributions of source code must retain the above copyright notice, this
+ *        list of conditions and the following disclaimer.
+ *
+ *     2. Redistributions in binary form must reproduce the above copyright notice,
+ *        this list of conditions and the following disclaimer in the documentation
+ *        and/or other materials provided with the distribution.
+ *
+ *     3. Neither the name of the copyright holder nor the names of its
+ *        contributors may be used to endorse or promote products derived from
+ *        this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * 17/10/26 09:19
+ */
+
+#include "frame.h"
+
+DENSITY_FORCE_INLINE DENSITY_STATE density_frame_check_header(const density_header *const header) {
+    if (header->version[0] > DENSITY_MAJOR_VERSION || header->flags & ~DENSITY_HEADER_FLAGS_KNOWN)
+        return DENSITY_STATE_ERROR_INVALID_HEADER;
+    if (header->flags & DENSITY_HEADER_FLAG_METADATA)
+        return DENSITY_STATE_OK;
+    if ((header->flags & DENSITY_HEADER_FLAG_BLOCKS) && (header->flags & (DENSITY_HEADER_FLAG_SEGMENTS | DENSITY_HEADER_FLAG_CONTENT_SIZE)))
+        return DENSITY_STATE_ERROR_INVALID_HEADER;  // Block frames already tell their content size
+    if ((header->flags & DENSITY_HEADER_FLAG_DICTIONARY) && (header->flags & (DENSITY_HEADER_FLAG_BLOCKS | DENSITY_HEADER_FLAG_SEGMENTS)))
+        return DENSITY_STATE_ERROR_INVALID_HEADER;  // Only single run frames are compressed from a pre-trained dictionary
+    if ((header->flags & DENSITY_HEADER_FLAG_STATIC_DICTIONARY) && !(header->flags & DENSITY_HEADER_FLAG_DICTIONARY))
+        return DENSITY_STATE_ERROR_INVALID_HEADER;
+    if ((header->flags & DENSITY_HEADER_FLAG_SESSION) && (header->flags & (DENSITY_HEADER_FLAG_BLOCKS | DENSITY_HEADER_FLAG_SEGMENTS) || !(header->flags & DENSITY_HEADER_FLAG_CONTENT_SIZE)))
+        return DENSITY_STATE_ERROR_INVALID_HEADER;  // Sessions are opened by a single run frame of known size
+    if (!density_get_dictionary_size((DENSITY_ALGORITHM) header->algorithm))
+        return DENSITY_STATE_ERROR_INVALID_ALGORITHM;
+    if (header->hash_bits < DENSITY_HASH_BITS_MINIMUM || header->hash_bits > DENSITY_HASH_BITS_MAXIMUM)
+        return DENSITY_STATE_ERROR_INVALID_HASH_BITS;
+    return DENSITY_STATE_OK;
+}
+
+DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE DENSITY_STATE density_frame_read(const uint8_t **DENSITY_RESTRICT in, const uint_fast64_t input_size, density_header *DENSITY_RESTRICT header, uint_fast64_t *DENSITY_RESTRICT content_size, uint_fast32_t *DENSITY_RESTRICT dictionary_id) {
+    const uint8_t *const start = *in;
+    while (true) {
+        if (input_size - (*in - start) < sizeof(density_header))
+            return DENSITY_STATE_ERROR_INPUT_BUFFER_TOO_SMALL;
+        density_header_read(in, header);
+        const DENSITY_STATE state = density_frame_check_header(header);
+        if (state)
+            return state;
+        if (!(header->flags & DENSITY_HEADER_FLAG_METADATA))
+            break;
+
+        // Metadata frames are skipped
+        density_frame_metadata_size metadata_size;
+        if (input_size - (*in - start) < sizeof(density_frame_metadata_size))
+            return DENSITY_STATE_ERROR_INPUT_BUFFER_TOO_SMALL;
+        DENSITY_MEMCPY(&metadata_size, *in, sizeof(density_frame_metadata_size));
+        *in += sizeof(density_frame_metadata_size);
+        if (input_size - (*in - start) < DENSITY_LITTLE_ENDIAN_32(metadata_size))
+            return DENSITY_STATE_ERROR_INPUT_BUFFER_TOO_SMALL;
+        *in += DENSITY_LITTLE_ENDIAN_32(metadata_size);
+    }
+
+    *content_size = 0;
+    if (header->flags & DENSITY_HEADER_FLAG_CONTENT_SIZE) {
+        density_frame_content_size endian_content_size;
+        if (input_size - (*in - start) < sizeof(density_frame_content_size))
+            return DENSITY_STATE_ERROR_INPUT_BUFFER_TOO_SMALL;
+        DENSITY_MEMCPY(&endian_content_size, *in, sizeof(density_frame_content_size));
+        *in += sizeof(density_frame_content_size);
+        *content_size = DENSITY_LITTLE_ENDIAN_64(endian_content_size);
+    } else if (header->flags & DENSITY_HEADER_FLAG_BLOCKS) {
+        density_blocks_descriptor descriptor;
+        const uint8_t *descriptor_in = *in;
+        if (input_size - (*in - start) < sizeof(density_blocks_descriptor))
+            return DENSITY_STATE_ERROR_INPUT_BUFFER_TOO_SMALL;
+        density_blocks_descriptor_read(&descriptor_in, &descriptor);
+        *content_size = descriptor.content_size;
+    }
+
+    *dictionary_id = 0;
+    if (header->flags & DENSITY_HEADER_FLAG_DICTIONARY) {
+        density_frame_dictionary_id endian_dictionary_id;
+        if (input_size - (*in - start) < sizeof(density_frame_dictionary_id))
+            return DENSITY_STATE_ERROR_INPUT_BUFFER_TOO_SMALL;
+        DENSITY_MEMCPY(&endian_dictionary_id, *in, sizeof(density_frame_dictionary_id));
+        *in += sizeof(density_frame_dictionary_id);
+        *dictionary_id = DENSITY_LITTLE_ENDIAN_32(endian_dictionary_id);
+    }
+    return DENSITY_STATE_OK;
+}
+
+DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE void density_frame_content_size_write(uint8_t **DENSITY_RESTRICT out, const uint_fast64_t content_size) {
+    const density_frame_content_size endian_content_size = DENSITY_LITTLE_ENDIAN_64((density_frame_content_size) content_size);
+    DENSITY_MEMCPY(*out, &endian_content_size, sizeof(density_frame_content_size));
+    *out += sizeof(density_frame_content_size);
+}
+
+DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE void density_frame_dictionary_id_write(uint8_t **DENSITY_RESTRICT out, const uint_fast32_t dictionary_id) {
+    const density_frame_dictionary_id endian_dictionary_id = DENSITY_LITTLE_ENDIAN_32((density_frame_dictionary_id) dictionary_id);
+    DENSITY_MEMCPY(*out, &endian_dictionary_id, sizeof(density_frame_dictionary_id));
+    *out += sizeof(density_frame_dictionary_id);
+}
+
+DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE void density_frame_metadata_write(uint8_t **DENSITY_RESTRICT out, const uint8_t *DENSITY_RESTRICT metadata, const uint_fast32_t metadata_size) {
+    density_header_write(out, (DENSITY_ALGORITHM) 0, DENSITY_HEADER_FLAG_METADATA, 0);
+    const density_frame_metadata_size endian_metadata_size = DENSITY_LITTLE_ENDIAN_32((density_frame_metadata_size) metadata_size);
+    DENSITY_MEMCPY(*out, &endian_metadata_size, sizeof(density_frame_metadata_size));
+    DENSITY_MEMCPY(*out + sizeof(density_frame_metadata_size), metadata, metadata_size);
+    *out += sizeof(density_frame_metadata_size) + metadata_size;
+}
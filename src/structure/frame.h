@@ -0,0 +1,59 @@
+/*
+ * Centaurean Density
+ *
+ * Copyright (c) 2013, Guillaume Voirin
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     1. Redistributions of source code must retain the above copyright notice, this
+ *        list of conditions and the following disclaimer.
+ *
+ *     2. Redistributions in binary form must reproduce the above copyright notice,
+ *        this list of conditions and the following disclaimer in the documentation
+ *        and/or other materials provided with the distribution.
+ *
+ *     3. Neither the name of the copyright holder nor the names of its
+ *        contributors may be used to endorse or promote products derived from
+ *        this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * 17/10/26 09:19
+ */
+
+#ifndef DENSITY_FRAME_H
+#define DENSITY_FRAME_H
+
+#include "../globals.h"
+#include "../density_api.h"
+#include "header.h"
+#include "blocks.h"
+
+/*
+ * A frame is a main header followed by what its flags announce :
+ * - DENSITY_HEADER_FLAG_CONTENT_SIZE : the decompressed size, before the compressed data
+ * - DENSITY_HEADER_FLAG_DICTIONARY : the id of the pre-trained dictionary the data was compressed from, after the decompressed size
+ * - DENSITY_HEADER_FLAG_METADATA : a metadata size then as many bytes of user data. Nothing else is in the frame, and decoders skip it to read the next one
+ */
+
+typedef uint64_t density_frame_content_size;
+typedef uint32_t density_frame_metadata_size;
+typedef uint32_t density_frame_dictionary_id;
+
+DENSITY_WINDOWS_EXPORT DENSITY_STATE density_frame_read(const uint8_t ** DENSITY_RESTRICT_DECLARE, const uint_fast64_t, density_header * DENSITY_RESTRICT_DECLARE, uint_fast64_t * DENSITY_RESTRICT_DECLARE, uint_fast32_t * DENSITY_RESTRICT_DECLARE);
+DENSITY_WINDOWS_EXPORT void density_frame_content_size_write(uint8_t ** DENSITY_RESTRICT_DECLARE, const uint_fast64_t);
+DENSITY_WINDOWS_EXPORT void density_frame_dictionary_id_write(uint8_t ** DENSITY_RESTRICT_DECLARE, const uint_fast32_t);
+DENSITY_WINDOWS_EXPORT void density_frame_metadata_write(uint8_t ** DENSITY_RESTRICT_DECLARE, const uint8_t * DENSITY_RESTRICT_DECLARE, const uint_fast32_t);
+
+#endif
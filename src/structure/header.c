@@ -39,17 +39,19 @@ DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE void density_header_read(const uint8
     header->version[1] = *(*in + 1);
     header->version[2] = *(*in + 2);
     header->algorithm = *(*in + 3);
+    header->flags = *(*in + 4);
+    header->hash_bits = *(*in + 5) ? *(*in + 5) : (density_byte) DENSITY_HASH_BITS_DEFAULT;
 
     *in += sizeof(density_header);
 }
 
-DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE void density_header_write(uint8_t **DENSITY_RESTRICT out, const DENSITY_ALGORITHM algorithm) {
+DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE void density_header_write(uint8_t **DENSITY_RESTRICT out, const DENSITY_ALGORITHM algorithm, const uint8_t flags, const uint8_t hash_bits) {
     *(*out) = DENSITY_MAJOR_VERSION;
     *(*out + 1) = DENSITY_MINOR_VERSION;
     *(*out + 2) = DENSITY_REVISION;
     *(*out + 3) = algorithm;
-    *(*out + 4) = 0;
-    *(*out + 5) = 0;
+    *(*out + 4) = flags;
+    *(*out + 5) = hash_bits;
     *(*out + 6) = 0;
     *(*out + 7) = 0;
 
@@ -41,18 +41,29 @@
 #include "../globals.h"
 #include "../density_api.h"
 
+#define DENSITY_HEADER_FLAG_BLOCKS              0x1     // Data is split in independently compressed blocks, see structure/blocks.h
+#define DENSITY_HEADER_FLAG_SEGMENTS            0x2     // Data is a sequence of dependent segments, see structure/segments.h
+#define DENSITY_HEADER_FLAG_CONTENT_SIZE        0x4     // Decompressed size follows the header, see structure/frame.h
+#define DENSITY_HEADER_FLAG_METADATA            0x8     // Skippable frame holding user metadata, see structure/frame.h
+#define DENSITY_HEADER_FLAG_DICTIONARY          0x10    // Data was compressed from a pre-trained dictionary, whose id follows, see structure/frame.h
+#define DENSITY_HEADER_FLAG_STATIC_DICTIONARY   0x20    // The pre-trained dictionary was only looked up, never updated, see algorithms/algorithms.h
+#define DENSITY_HEADER_FLAG_SESSION             0x40    // Data opens a session, continued by header-less frames, see structure/session_header.h
+#define DENSITY_HEADER_FLAGS_KNOWN              (DENSITY_HEADER_FLAG_BLOCKS | DENSITY_HEADER_FLAG_SEGMENTS | DENSITY_HEADER_FLAG_CONTENT_SIZE | DENSITY_HEADER_FLAG_METADATA | DENSITY_HEADER_FLAG_DICTIONARY | DENSITY_HEADER_FLAG_STATIC_DICTIONARY | DENSITY_HEADER_FLAG_SESSION)
+
 #pragma pack(push)
 #pragma pack(4)
 
 typedef struct {
     density_byte version[3];
     density_byte algorithm;
-    density_byte reserved[4];
+    density_byte flags;
+    density_byte hash_bits;     // Dictionary hash width, 0 in data written before it was configurable
+    density_byte reserved[2];
 } density_header;
 
 #pragma pack(pop)
 
 DENSITY_WINDOWS_EXPORT void density_header_read(const uint8_t ** DENSITY_RESTRICT_DECLARE, density_header * DENSITY_RESTRICT_DECLARE);
-DENSITY_WINDOWS_EXPORT void density_header_write(uint8_t ** DENSITY_RESTRICT_DECLARE, const DENSITY_ALGORITHM);
+DENSITY_WINDOWS_EXPORT void density_header_write(uint8_t ** DENSITY_RESTRICT_DECLARE, const DENSITY_ALGORITHM, const uint8_t, const uint8_t);
 
 #endif
@@ -0,0 +1,53 @@
+/*
+ * Centaurean Density
+ *
+ * Copyright (c) 2013, Guillaume Voirin
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     1. Redistributions of source code must retain the above copyright notice, this
+ *        list of conditions and the following disclaimer.
+ *
+ *     2. Redistributions in binary form must reproduce the above copyright notice,
+ *        this list of conditions and the following disclaimer in the documentation
+ *        and/or other materials provided with the distribution.
+ *
+ *     3. Neither the name of the copyright holder nor the names of its
+ *        contributors may be used to endorse or promote products derived from
+ *        this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * 17/10/26 08:54
+ */
+
+#include "segments.h"
+
+DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE void density_segment_header_read(const uint8_t **DENSITY_RESTRICT in, density_segment_header *DENSITY_RESTRICT header) {
+    uint32_t decompressed_size;
+    uint32_t compressed_size;
+    DENSITY_MEMCPY(&decompressed_size, *in, sizeof(uint32_t));
+    DENSITY_MEMCPY(&compressed_size, *in + sizeof(uint32_t), sizeof(uint32_t));
+    header->decompressed_size = DENSITY_LITTLE_ENDIAN_32(decompressed_size);
+    header->compressed_size = DENSITY_LITTLE_ENDIAN_32(compressed_size);
+
+    *in += sizeof(density_segment_header);
+}
+
+DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE void density_segment_header_write(uint8_t *const out, const uint_fast32_t decompressed_size, const uint_fast32_t compressed_size) {
+    const uint32_t endian_decompressed_size = DENSITY_LITTLE_ENDIAN_32((uint32_t) decompressed_size);
+    const uint32_t endian_compressed_size = DENSITY_LITTLE_ENDIAN_32((uint32_t) compressed_size);
+    DENSITY_MEMCPY(out, &endian_decompressed_size, sizeof(uint32_t));
+    DENSITY_MEMCPY(out + sizeof(uint32_t), &endian_compressed_size, sizeof(uint32_t));
+}
@@ -0,0 +1,64 @@
+/*
+ * Centaurean Density
+ *
+ * Copyright (c) 2013, Guillaume Voirin
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     1. Redistributions of source code must retain the above copyright notice, this
+ *        list of conditions and the following disclaimer.
+ *
+ *     2. Redistributions in binary form must reproduce the above copyright notice,
+ *        this list of conditions and the following disclaimer in the documentation
+ *        and/or other materials provided with the distribution.
+ *
+ *     3. Neither the name of the copyright holder nor the names of its
+ *        contributors may be used to endorse or promote products derived from
+ *        this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * 17/10/26 08:54
+ */
+
+#ifndef DENSITY_SEGMENTS_H
+#define DENSITY_SEGMENTS_H
+
+#include "../globals.h"
+#include "../density_api.h"
+
+#define DENSITY_SEGMENTS_SIZE                   (1 << 16)
+#define DENSITY_SEGMENTS_SYNC_MARKER            0x434e5953      // Compressed size of the empty segment marking a sync point
+
+/*
+ * A segmented stream follows the main header when DENSITY_HEADER_FLAG_SEGMENTS is set : a sequence of segments,
+ * each one being a segment header followed by its compressed data, and an empty segment marking the end.
+ * Segments hold at most DENSITY_SEGMENTS_SIZE decompressed bytes and are encoded one after the other with the same
+ * dictionary and algorithm state, so they cannot be processed independently.
+ * An empty segment whose compressed size is DENSITY_SEGMENTS_SYNC_MARKER is a sync point : dictionary and state start over
+ * behind it, so decoding can start at any sync point.
+ */
+
+#pragma pack(push)
+#pragma pack(4)
+typedef struct {
+    uint32_t decompressed_size;
+    uint32_t compressed_size;
+} density_segment_header;
+#pragma pack(pop)
+
+DENSITY_WINDOWS_EXPORT void density_segment_header_read(const uint8_t ** DENSITY_RESTRICT_DECLARE, density_segment_header * DENSITY_RESTRICT_DECLARE);
+DENSITY_WINDOWS_EXPORT void density_segment_header_write(uint8_t *const, const uint_fast32_t, const uint_fast32_t);
+
+#endif
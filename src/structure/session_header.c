@@ -0,0 +1,59 @@
+/*
+ * Centaurean Density
+ *
+ * Copyright (c) 2013, Guillaume Voirin
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     1. Redistributions of source code must retain the above copyright notice, this
+ *        list of conditions and the following disclaimer.
+ *
+ *     2. Redistributions in binary form must reproduce the above copyright notice,
+ *        this list of conditions and the following disclaimer in the documentation
+ *        and/or other materials provided with the distribution.
+ *
+ *     3. Neither the name of the copyright holder nor the names of its
+ *        contributors may be used to endorse or promote products derived from
+ *        this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * 17/10/26 12:07
+ */
+
+#include "session_header.h"
+
+DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE void density_session_header_read(const uint8_t **DENSITY_RESTRICT in, density_session_header *DENSITY_RESTRICT header) {
+    uint16_t sequence;
+    uint32_t decompressed_size;
+    header->marker = (*in)[0];
+    header->reserved = (*in)[1];
+    DENSITY_MEMCPY(&sequence, *in + 2, sizeof(uint16_t));
+    DENSITY_MEMCPY(&decompressed_size, *in + 2 + sizeof(uint16_t), sizeof(uint32_t));
+    header->sequence = DENSITY_LITTLE_ENDIAN_16(sequence);
+    header->decompressed_size = DENSITY_LITTLE_ENDIAN_32(decompressed_size);
+
+    *in += sizeof(density_session_header);
+}
+
+DENSITY_WINDOWS_EXPORT DENSITY_FORCE_INLINE void density_session_header_write(uint8_t **DENSITY_RESTRICT out, const uint_fast16_t sequence, const uint_fast32_t decompressed_size) {
+    const uint16_t endian_sequence = DENSITY_LITTLE_ENDIAN_16((uint16_t) sequence);
+    const uint32_t endian_decompressed_size = DENSITY_LITTLE_ENDIAN_32((uint32_t) decompressed_size);
+    (*out)[0] = DENSITY_SESSION_MARKER;
+    (*out)[1] = 0;
+    DENSITY_MEMCPY(*out + 2, &endian_sequence, sizeof(uint16_t));
+    DENSITY_MEMCPY(*out + 2 + sizeof(uint16_t), &endian_decompressed_size, sizeof(uint32_t));
+
+    *out += sizeof(density_session_header);
+}
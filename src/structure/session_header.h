@@ -0,0 +1,64 @@
+/*
+ * Centaurean Density
+ *
+ * Copyright (c) 2013, Guillaume Voirin
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     1. Redistributions of source code must retain the above copyright notice, this
+ *        list of conditions and the following disclaimer.
+ *
+ *     2. Redistributions in binary form must reproduce the above copyright notice,
+ *        this list of conditions and the following disclaimer in the documentation
+ *        and/or other materials provided with the distribution.
+ *
+ *     3. Neither the name of the copyright holder nor the names of its
+ *        contributors may be used to endorse or promote products derived from
+ *        this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * 17/10/26 12:07
+ */
+
+#ifndef DENSITY_SESSION_HEADER_H
+#define DENSITY_SESSION_HEADER_H
+
+#include "../globals.h"
+#include "../density_api.h"
+
+#define DENSITY_SESSION_MARKER                  0xff    // First byte of continuation frames, a major version no main header carries
+
+/*
+ * A session is a sequence of messages compressed one after the other with the same dictionary, each one in its own frame.
+ * The message opening the session is a regular frame whose flags include DENSITY_HEADER_FLAG_SESSION, and decoders start
+ * over from a fresh dictionary when they meet one. Each following message is a continuation frame : a session header, then
+ * the compressed data. Its sequence number, counting messages from the opening one which is 0, lets decoders check that no
+ * message was lost, duplicated or reordered.
+ */
+
+#pragma pack(push)
+#pragma pack(4)
+typedef struct {
+    density_byte marker;
+    density_byte reserved;
+    uint16_t sequence;      // Wraps around
+    uint32_t decompressed_size;
+} density_session_header;
+#pragma pack(pop)
+
+DENSITY_WINDOWS_EXPORT void density_session_header_read(const uint8_t ** DENSITY_RESTRICT_DECLARE, density_session_header * DENSITY_RESTRICT_DECLARE);
+DENSITY_WINDOWS_EXPORT void density_session_header_write(uint8_t ** DENSITY_RESTRICT_DECLARE, const uint_fast16_t, const uint_fast32_t);
+
+#endif
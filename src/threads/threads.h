@@ -0,0 +1,72 @@
+/*
+ * Centaurean Density
+ *
+ * Copyright (c) 2013, Guillaume Voirin
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *     1. Redistributions of source code must retain the above copyright notice, this
+ *        list of conditions and the following disclaimer.
+ *
+ *     2. Redistributions in binary form must reproduce the above copyright notice,
+ *        this list of conditions and the following disclaimer in the documentation
+ *        and/or other materials provided with the distribution.
+ *
+ *     3. Neither the name of the copyright holder nor the names of its
+ *        contributors may be used to endorse or promote products derived from
+ *        this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * 17/10/26 04:06
+ */
+
+#ifndef DENSITY_THREADS_H
+#define DENSITY_THREADS_H
+
+#include "../globals.h"
+
+#if defined(_WIN64) || defined(_WIN32)
+#include <windows.h>
+
+typedef HANDLE density_thread;
+typedef LPTHREAD_START_ROUTINE density_thread_function;
+
+#define DENSITY_THREAD_FUNCTION(name, argument)     DWORD WINAPI name(LPVOID argument)
+#define DENSITY_THREAD_EXIT                         return 0
+#else
+#include <pthread.h>
+
+typedef pthread_t density_thread;
+typedef void *(*density_thread_function)(void *);
+
+#define DENSITY_THREAD_FUNCTION(name, argument)     void *name(void *argument)
+#define DENSITY_THREAD_EXIT                         return NULL
+#endif
+
+#if defined(_MSC_VER)
+#define DENSITY_THREAD_LOCAL                        __declspec(thread)
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+#define DENSITY_THREAD_LOCAL                        _Thread_local
+#else
+#define DENSITY_THREAD_LOCAL                        __thread
+#endif
+
+#define DENSITY_THREADS_MAXIMUM                     256
+
+DENSITY_WINDOWS_EXPORT bool density_thread_create(density_thread *const, density_thread_function, void *const);
+DENSITY_WINDOWS_EXPORT void density_thread_join(const density_thread);
+DENSITY_WINDOWS_EXPORT uint_fast16_t density_threads_available(void);
+
+#endif